@@ -0,0 +1,413 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "pythonplugin.h"
+#include <structmember.h>
+#include "nativefunctions.h"
+#include "pysamp.h"
+#include "scratch.h"
+#include "cp1252.h"
+#include "compiledcall.h"
+#include "nativeprofile.h"
+#include "textdraws.h"
+
+// scripts publics are called in, in load order like CallRemoteFunction does;
+// the server has at most 16 filterscripts next to the gamemode
+#define MAX_TRACKED_AMX		32
+
+struct compiled_call
+{
+	PyObject_HEAD
+	vectorcallfunc vectorcall;
+	PyObject *name;
+	PyObject *format;
+	amx_function_t func;	// the native; NULL for publics
+	int count;
+	char kinds[MAX_COMPILED_ARGS];
+	// name for amx_FindPublic and the native profiler
+	char cname[sNAMEMAX + 1];
+	// publics: index in every tracked script or -1, resolved again after scripts
+	// were loaded or unloaded; guarded by m_amxLock
+	unsigned int generation;
+	int indices[MAX_TRACKED_AMX];
+};
+
+static AMX *m_amxList[MAX_TRACKED_AMX];
+static int m_amxCount = 0;
+static unsigned int m_amxGeneration = 1;
+// guards the script list and the resolved indices of every public; never held while
+// running a public, those can load and unload scripts themselves
+static Mutex m_amxLock;
+
+void _compiledAmxLoad(AMX *amx)
+{
+	m_amxLock.Lock();
+	bool full = m_amxCount == MAX_TRACKED_AMX;
+	if (!full)
+	{
+		m_amxList[m_amxCount++] = amx;
+		m_amxGeneration++;
+	}
+	m_amxLock.Unlock();
+
+	if (full)
+		logprintf("PYTHON: Too many scripts, samp.public won't call into the new one");
+}
+
+void _compiledAmxUnload(AMX *amx)
+{
+	m_amxLock.Lock();
+	for (int i = 0; i < m_amxCount; i++)
+	{
+		if (m_amxList[i] == amx)
+		{
+			memmove(&m_amxList[i], &m_amxList[i + 1], (m_amxCount - i - 1) * sizeof(AMX *));
+			m_amxCount--;
+			m_amxGeneration++;
+			break;
+		}
+	}
+	m_amxLock.Unlock();
+}
+
+// index of the public in a script that is still tracked, -1 otherwise; for scripts
+// loaded or unloaded since the caller took its copy of the list
+static int _compiledFind(compiled_call *self, AMX *amx)
+{
+	int index = -1;
+	m_amxLock.Lock();
+	for (int i = 0; i < m_amxCount; i++)
+	{
+		if (m_amxList[i] == amx)
+		{
+			if (amx_FindPublic(amx, self->cname, &index) != AMX_ERR_NONE)
+				index = -1;
+			break;
+		}
+	}
+	m_amxLock.Unlock();
+	return index;
+}
+
+// numbers by format code; strings are handled by the callers
+static bool _compiledValue(char kind, PyObject *o, cell *value)
+{
+	switch (kind)
+	{
+	case 'b':
+	{
+		int v = PyObject_IsTrue(o);
+		*value = v;
+		return v != -1;
+	}
+	case 'f':
+	{
+		float v = (float)PyFloat_AsDouble(o);
+		*value = amx_ftoc(v);
+		return !(v == -1.0f && PyErr_Occurred());
+	}
+	default:
+	{
+		long v = PyLong_AsLong(o);
+		*value = v;
+		return !(v == -1 && PyErr_Occurred());
+	}
+	}
+}
+
+static PyObject *_compiledCallNative(compiled_call *self, PyObject *const *args)
+{
+	cell params[MAX_COMPILED_ARGS + 1];
+	scratch_mark mark = _scratchMark();
+	bool ok = true;
+
+	for (int i = 0; ok && i < self->count; i++)
+	{
+		if (self->kinds[i] == 's')
+		{
+			Py_ssize_t size = _cp1252Size(args[i]);
+			cell *addr = size == -1 ? NULL : _scratchAllot((int)size, &params[i + 1]);
+			ok = addr != NULL && _cp1252ToCells(args[i], addr, size);
+		}
+		else
+			ok = _compiledValue(self->kinds[i], args[i], &params[i + 1]);
+	}
+
+	PyObject *ret = NULL;
+	if (ok)
+	{
+		params[0] = self->count * sizeof(cell);
+		cell retval = _nativeInvoke(self->cname, self->func, m_AMX, params);
+		_textdrawNativeCalled(self->cname, params, retval);
+		ret = PyLong_FromLong(retval);
+	}
+	_scratchRelease(mark);
+	return ret;
+}
+
+// needs m_amxLock
+static void _compiledResolve(compiled_call *self)
+{
+	for (int i = 0; i < m_amxCount; i++)
+	{
+		if (amx_FindPublic(m_amxList[i], self->cname, &self->indices[i]) != AMX_ERR_NONE)
+			self->indices[i] = -1;
+	}
+	self->generation = m_amxGeneration;
+}
+
+// pushes the arguments and runs the public in one script; false with a Python exception
+// set if the arguments couldn't be put on its heap
+static bool _compiledExec(compiled_call *self, PyObject *const *args, const cell *values, AMX *amx, int index, cell *retval, int *error)
+{
+	cell hea = amx->hea;
+	cell addrs[MAX_COMPILED_ARGS];
+	for (int i = 0; i < self->count; i++)
+	{
+		if (self->kinds[i] != 's')
+			continue;
+
+		cell *phys;
+		if (amx_Allot(amx, values[i], &addrs[i], &phys) != AMX_ERR_NONE)
+		{
+			amx_Release(amx, hea);
+			PyErr_SetString(PyExc_MemoryError, "AMX heap is full");
+			return false;
+		}
+		if (!_cp1252ToCells(args[i], phys, values[i]))
+		{
+			amx_Release(amx, hea);
+			return false;
+		}
+	}
+
+	// last argument first
+	for (int i = self->count - 1; i >= 0; i--)
+		amx_Push(amx, self->kinds[i] == 's' ? addrs[i] : values[i]);
+
+	*error = amx_Exec(amx, retval, index);
+	amx_Release(amx, hea);
+	return true;
+}
+
+static PyObject *_compiledCallPublic(compiled_call *self, PyObject *const *args)
+{
+	// numbers are converted once, strings go to the heap of every script that gets called,
+	// values[] has their size for them
+	cell values[MAX_COMPILED_ARGS];
+	for (int i = 0; i < self->count; i++)
+	{
+		if (self->kinds[i] == 's')
+		{
+			Py_ssize_t size = _cp1252Size(args[i]);
+			if (size == -1)
+				return NULL;
+			values[i] = (cell)size;
+		}
+		else if (!_compiledValue(self->kinds[i], args[i], &values[i]))
+			return NULL;
+	}
+
+	// the publics can load and unload scripts, so walk a copy
+	AMX *list[MAX_TRACKED_AMX];
+	int indices[MAX_TRACKED_AMX];
+	m_amxLock.Lock();
+	if (self->generation != m_amxGeneration)
+		_compiledResolve(self);
+	int count = m_amxCount;
+	unsigned int generation = m_amxGeneration;
+	memcpy(list, m_amxList, count * sizeof(AMX *));
+	memcpy(indices, self->indices, count * sizeof(int));
+	m_amxLock.Unlock();
+
+	bool called = false;
+	cell ret = 0;
+	for (int n = 0; n < count; n++)
+	{
+		AMX *amx = list[n];
+		m_amxLock.Lock();
+		bool changed = m_amxGeneration != generation;
+		m_amxLock.Unlock();
+
+		int index = changed ? _compiledFind(self, amx) : indices[n];
+		if (index < 0)
+			continue;
+
+		cell retval;
+		int error;
+		if (!_compiledExec(self, args, values, amx, index, &retval, &error))
+			return NULL;
+		if (error != AMX_ERR_NONE)
+		{
+			logprintf("PYTHON: public %s failed with AMX error %d", self->cname, error);
+			continue;
+		}
+		ret = retval;
+		called = true;
+	}
+
+	// None when no script has the public
+	if (!called)
+		Py_RETURN_NONE;
+	return PyLong_FromLong(ret);
+}
+
+static PyObject *_compiledVectorcall(PyObject *callable, PyObject *const *args, size_t nargsf, PyObject *kwnames)
+{
+	compiled_call *self = (compiled_call *)callable;
+	Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+
+	if (kwnames != NULL && PyTuple_GET_SIZE(kwnames) != 0)
+	{
+		PyErr_Format(PyExc_TypeError, "%U() takes no keyword arguments", self->name);
+		return NULL;
+	}
+	if (nargs != self->count)
+	{
+		PyErr_Format(PyExc_TypeError, "%U() takes exactly %d arguments (%zd given)", self->name, self->count, nargs);
+		return NULL;
+	}
+
+	if (self->func == NULL)
+		return _compiledCallPublic(self, args);
+	return _compiledCallNative(self, args);
+}
+
+static PyObject *_compiledRepr(PyObject *o)
+{
+	compiled_call *self = (compiled_call *)o;
+	return PyUnicode_FromFormat("<samp.%s %U(%R)>", self->func == NULL ? "public" : "native", self->name, self->format);
+}
+
+static void _compiledDealloc(PyObject *o)
+{
+	compiled_call *self = (compiled_call *)o;
+	PyTypeObject *type = Py_TYPE(o);
+	Py_XDECREF(self->name);
+	Py_XDECREF(self->format);
+	type->tp_free(o);
+	Py_DECREF(type);
+}
+
+static PyMemberDef _compiledMembers[] =
+{
+	{ "__vectorcalloffset__", T_PYSSIZET, offsetof(compiled_call, vectorcall), READONLY, NULL },
+	{ "name", T_OBJECT, offsetof(compiled_call, name), READONLY, "Name of the native or public" },
+	{ "format", T_OBJECT, offsetof(compiled_call, format), READONLY, "Argument format" },
+	{ NULL }
+};
+
+static PyType_Slot _compiledSlots[] =
+{
+	{ Py_tp_call, (void *)PyVectorcall_Call },
+	{ Py_tp_repr, (void *)_compiledRepr },
+	{ Py_tp_dealloc, (void *)_compiledDealloc },
+	{ Py_tp_members, _compiledMembers },
+	{ Py_tp_doc, (void *)"Native or public with a precompiled argument format" },
+	{ 0, NULL }
+};
+
+static PyType_Spec _compiledSpec =
+{
+	"samp.CompiledCall",
+	sizeof(compiled_call),
+	0,
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_VECTORCALL | Py_TPFLAGS_DISALLOW_INSTANTIATION,
+	_compiledSlots
+};
+
+PyTypeObject *_compiledNewType(PyObject *module)
+{
+	return (PyTypeObject *)PyType_FromModuleAndSpec(module, &_compiledSpec, NULL);
+}
+
+static compiled_call *_compiledNew(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+	PyObject *name, *format;
+	_pyParseFast(args, nargs, "O!O!", &PyUnicode_Type, &name, &PyUnicode_Type, &format);
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	Py_ssize_t count = PyUnicode_GET_LENGTH(format);
+	if (count > MAX_COMPILED_ARGS)
+	{
+		PyErr_Format(PyExc_ValueError, "at most %d arguments are supported", MAX_COMPILED_ARGS);
+		return NULL;
+	}
+	if (!PyUnicode_IS_ASCII(format) || strspn((const char *)PyUnicode_1BYTE_DATA(format), "idbfs") != (size_t)count)
+	{
+		PyErr_Format(PyExc_ValueError, "invalid format %R, expected the codes i, d, b, f and s", format);
+		return NULL;
+	}
+
+	compiled_call *self = PyObject_New(compiled_call, _pyCompiledType(module));
+	if (self == NULL)
+		return NULL;
+	self->vectorcall = _compiledVectorcall;
+	self->name = name;
+	self->format = format;
+	Py_INCREF(name);
+	Py_INCREF(format);
+	self->func = NULL;
+	self->count = (int)count;
+	memcpy(self->kinds, PyUnicode_1BYTE_DATA(format), count);
+	self->cname[0] = '\0';
+	self->generation = 0;
+	return self;
+}
+
+// native(name, format)
+PyObject *sNative(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	compiled_call *call = _compiledNew(self, args, nargs);
+	if (call == NULL)
+		return NULL;
+
+	Py_ssize_t len;
+	const char *name = PyUnicode_AsUTF8AndSize(call->name, &len);
+	if (name != NULL && len <= sNAMEMAX)
+		call->func = _findNativeCached(m_AMX, name, len);
+	if (call->func == NULL)
+	{
+		if (name != NULL)
+			PyErr_Format(PyExc_NameError, "Unknown native function %s", name);
+		Py_DECREF(call);
+		return NULL;
+	}
+	memcpy(call->cname, name, len + 1);
+	return (PyObject *)call;
+}
+
+// public(name, format)
+PyObject *sPublic(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	compiled_call *call = _compiledNew(self, args, nargs);
+	if (call == NULL)
+		return NULL;
+
+	Py_ssize_t len;
+	const char *name = PyUnicode_AsUTF8AndSize(call->name, &len);
+	if (name == NULL || len > sNAMEMAX)
+	{
+		if (name != NULL)
+			PyErr_Format(PyExc_ValueError, "public names are at most %d characters long", sNAMEMAX);
+		Py_DECREF(call);
+		return NULL;
+	}
+	memcpy(call->cname, name, len + 1);
+	return (PyObject *)call;
+}
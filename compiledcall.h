@@ -0,0 +1,38 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef __compiled_call_h_
+#define __compiled_call_h_
+
+// samp.native(name, format) and samp.public(name, format) return callables which
+// convert their arguments by the format given once, instead of looking at the Python
+// types on every call like CallNativeFunction and CallRemoteFunction do.
+// Publics are run with amx_Exec in every script that has them, skipping CallRemoteFunction;
+// the call returns the value of the last one, or None if no script has the public.
+//
+// format codes: i, d - int    b - bool    f - float    s - str, encoded to cp1252
+
+#define MAX_COMPILED_ARGS	32
+
+PyTypeObject *_compiledNewType(PyObject *module);
+void _compiledAmxLoad(AMX *amx);
+void _compiledAmxUnload(AMX *amx);
+
+PyObject *sNative(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sPublic(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+
+#endif
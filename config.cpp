@@ -0,0 +1,79 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "pythonplugin.h"
+#include "pysamp.h"
+#include "config.h"
+
+plugin_config m_Config =
+{
+	ENABLE_MULTITHREAD != 0,	// multithread
+	false,						// gil_priority
+	false,						// isolated
+	false,						// snapshot
+	false						// gil_stats
+};
+
+static bool _configBool(const char *key, const char *value)
+{
+	if (!strcmp(value, "1") || !strcmp(value, "true") || !strcmp(value, "on")) return true;
+	if (!strcmp(value, "0") || !strcmp(value, "false") || !strcmp(value, "off")) return false;
+
+	logprintf("PYTHON: Config: invalid value '%s' for %s, using 0", value, key);
+	return false;
+}
+
+// reads the plugin config; a missing file just keeps the defaults
+void _loadConfig(const char *filename)
+{
+	FILE *f = fopen(filename, "r");
+	if (f == NULL)
+		return;
+
+	char line[256], key[64], value[128];
+	while (fgets(line, sizeof(line), f) != NULL)
+	{
+		if (sscanf(line, "%63s %127s", key, value) != 2 || key[0] == '#')
+			continue;
+
+		if (!strcmp(key, "threading"))
+		{
+			if (!strcmp(value, "multi")) m_Config.multithread = true;
+			else if (!strcmp(value, "single")) m_Config.multithread = false;
+			else logprintf("PYTHON: Config: invalid value '%s' for threading, expected multi or single", value);
+		}
+		else if (!strcmp(key, "gil_priority"))
+			m_Config.gil_priority = _configBool(key, value);
+		else if (!strcmp(key, "isolated"))
+			m_Config.isolated = _configBool(key, value);
+		else if (!strcmp(key, "snapshot"))
+			m_Config.snapshot = _configBool(key, value);
+		else if (!strcmp(key, "gil_stats"))
+			m_Config.gil_stats = _configBool(key, value);
+		else
+			logprintf("PYTHON: Config: unknown key %s", key);
+	}
+	fclose(f);
+
+#if !ENABLE_MULTITHREAD
+	if (m_Config.multithread)
+	{
+		logprintf("PYTHON: Config: plugin was built without threading support, using threading single");
+		m_Config.multithread = false;
+	}
+#endif
+}
@@ -0,0 +1,37 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef __config_h_
+#define __config_h_
+
+// optional, in the server directory; same format as server.cfg ("key value" per line)
+#define PLUGIN_CONFIG_FILE	"python_plugin.cfg"
+
+struct plugin_config
+{
+	bool multithread;	// threading multi|single: run Python's main thread on its own thread
+	bool gil_priority;	// gil_priority 0|1: start with GIL priority mode enabled
+	bool isolated;		// isolated 0|1: default for LoadPython's isolated parameter
+	bool snapshot;		// snapshot 0|1: capture all players every tick (samp.snapshot)
+	bool gil_stats;		// gil_stats 0|1: record GIL histograms from the start (samp.gil_stats)
+};
+
+extern plugin_config m_Config;
+
+void _loadConfig(const char *filename);
+
+#endif
@@ -0,0 +1,215 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "pythonplugin.h"
+#include "cp1252.h"
+
+#define CP1252_UNDEFINED	0xFFFF
+
+// 0x80 - 0x9F; everything else maps to the same code point
+static const Py_UCS2 _cp1252High[32] =
+{
+	0x20AC, CP1252_UNDEFINED, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+	0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, CP1252_UNDEFINED, 0x017D, CP1252_UNDEFINED,
+	CP1252_UNDEFINED, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+	0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, CP1252_UNDEFINED, 0x017E, 0x0178
+};
+
+static inline Py_UCS4 _cp1252Decode(unsigned char c)
+{
+	return (c & 0xE0) == 0x80 ? _cp1252High[c - 0x80] : c;
+}
+
+// returns the byte for ch, or -1 if cp1252 doesn't have it
+static inline int _cp1252Encode(Py_UCS4 ch)
+{
+	if (ch < 0x80 || (ch >= 0xA0 && ch <= 0xFF))
+		return (int)ch;
+	if (ch == CP1252_UNDEFINED)
+		return -1;
+
+	for (int i = 0; i < 32; i++)
+	{
+		if (_cp1252High[i] == ch)
+			return 0x80 + i;
+	}
+	return -1;
+}
+
+// lets Python's codec raise the UnicodeEncodeError
+static bool _cp1252EncodeError(PyObject *str)
+{
+	PyObject *bytes = PyUnicode_AsEncodedString(str, "cp1252", "strict");
+	Py_XDECREF(bytes);
+	if (bytes != NULL) // can't happen, but don't return false without an exception
+		PyErr_SetString(PyExc_UnicodeEncodeError, "cp1252 table mismatch");
+	return false;
+}
+
+Py_ssize_t _cp1252Size(PyObject *str)
+{
+	if (!PyUnicode_Check(str))
+	{
+		PyErr_Format(PyExc_TypeError, "expected str, not %.200s", Py_TYPE(str)->tp_name);
+		return -1;
+	}
+	// one byte per character
+	return PyUnicode_GET_LENGTH(str) + 1;
+}
+
+template <class T>
+static bool _cp1252EncodeTo(PyObject *str, T *dest, Py_ssize_t size)
+{
+	if (_cp1252Size(str) == -1)
+		return false;
+
+	Py_ssize_t len = PyUnicode_GET_LENGTH(str);
+	if (len >= size)
+		len = size - 1;
+
+	if (PyUnicode_IS_ASCII(str))
+	{
+		const unsigned char *data = PyUnicode_1BYTE_DATA(str);
+		for (Py_ssize_t i = 0; i < len; i++)
+			dest[i] = data[i];
+	}
+	else
+	{
+		int kind = PyUnicode_KIND(str);
+		const void *data = PyUnicode_DATA(str);
+		for (Py_ssize_t i = 0; i < len; i++)
+		{
+			int c = _cp1252Encode(PyUnicode_READ(kind, data, i));
+			if (c == -1)
+				return _cp1252EncodeError(str);
+			dest[i] = (T)c;
+		}
+	}
+	dest[len] = 0;
+	return true;
+}
+
+bool _cp1252ToCells(PyObject *str, cell *dest, Py_ssize_t size)
+{
+	return _cp1252EncodeTo(str, dest, size);
+}
+
+bool _cp1252ToChars(PyObject *str, char *dest, Py_ssize_t size)
+{
+	return _cp1252EncodeTo(str, dest, size);
+}
+
+// byte i of an unpacked (one character per cell or char) string
+template <class T> struct cp1252_unpacked
+{
+	const T *src;
+	unsigned char operator[](Py_ssize_t i) const { return (unsigned char)src[i]; }
+};
+
+// byte i of a packed AMX string, the first character in the most significant byte
+struct cp1252_packed
+{
+	const cell *src;
+	unsigned char operator[](Py_ssize_t i) const
+	{
+		return (unsigned char)((ucell)src[i / sizeof(cell)] >> ((sizeof(cell) - 1 - i % sizeof(cell)) * 8));
+	}
+};
+
+// two passes over the source: one for the length and the widest character, one to
+// fill in the str, so there is no buffer in between
+template <class S>
+static PyObject *_cp1252DecodeFrom(S src, Py_ssize_t len, bool replace)
+{
+	// the terminator, the widest character and whether there are undefined ones
+	Py_UCS4 maxchar = 0;
+	bool undefined = false;
+	Py_ssize_t n;
+	for (n = 0; n < len && src[n] != 0; n++)
+	{
+		Py_UCS4 ch = _cp1252Decode((unsigned char)src[n]);
+		if (ch == CP1252_UNDEFINED)
+		{
+			undefined = true;
+			ch = 0xFFFD;
+		}
+		if (ch > maxchar)
+			maxchar = ch;
+	}
+
+	if (undefined && !replace)
+	{
+		// let Python's codec raise the UnicodeDecodeError
+		std::string bytes(n, '\0');
+		for (Py_ssize_t i = 0; i < n; i++)
+			bytes[i] = (char)src[i];
+		return PyUnicode_Decode(bytes.data(), n, "cp1252", "strict");
+	}
+
+	PyObject *str = PyUnicode_New(n, maxchar);
+	if (str == NULL)
+		return NULL;
+
+	if (maxchar < 0x80)
+	{
+		Py_UCS1 *data = PyUnicode_1BYTE_DATA(str);
+		for (Py_ssize_t i = 0; i < n; i++)
+			data[i] = (Py_UCS1)src[i];
+	}
+	else
+	{
+		int kind = PyUnicode_KIND(str);
+		void *data = PyUnicode_DATA(str);
+		for (Py_ssize_t i = 0; i < n; i++)
+		{
+			Py_UCS4 ch = _cp1252Decode((unsigned char)src[i]);
+			PyUnicode_WRITE(kind, data, i, ch == CP1252_UNDEFINED ? 0xFFFD : ch);
+		}
+	}
+	return str;
+}
+
+PyObject *_cp1252FromCells(const cell *src, Py_ssize_t len, bool replace)
+{
+	cp1252_unpacked<cell> s = { src };
+	return _cp1252DecodeFrom(s, len, replace);
+}
+
+PyObject *_cp1252FromChars(const char *src, Py_ssize_t len, bool replace)
+{
+	cp1252_unpacked<char> s = { src };
+	return _cp1252DecodeFrom(s, len, replace);
+}
+
+PyObject *_cp1252FromAMX(AMX *amx, cell amx_addr, bool replace)
+{
+	cell *addr;
+	if (amx_GetAddr(amx, amx_addr, &addr) != AMX_ERR_NONE)
+	{
+		PyErr_SetString(PyExc_ValueError, "invalid AMX string address");
+		return NULL;
+	}
+
+	// same test as amx_StrLen
+	if ((ucell)*addr > UNPACKEDMAX)
+	{
+		cp1252_packed s = { addr };
+		return _cp1252DecodeFrom(s, PY_SSIZE_T_MAX, replace);
+	}
+	cp1252_unpacked<cell> s = { addr };
+	return _cp1252DecodeFrom(s, PY_SSIZE_T_MAX, replace);
+}
@@ -0,0 +1,40 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef __cp1252_h_
+#define __cp1252_h_
+
+// cp1252 codec working directly on PyUnicode storage and AMX cells; SA-MP strings are
+// cp1252, one cell (unpacked) or byte per character. Errors are raised by the cp1252
+// codec of Python itself, so they look the same as before.
+
+// cells needed for str including the terminator, -1 with a TypeError if it isn't a str
+Py_ssize_t _cp1252Size(PyObject *str);
+// encodes str into size cells (unpacked, including the terminator);
+// size has to be at least PyUnicode_GET_LENGTH(str) + 1
+bool _cp1252ToCells(PyObject *str, cell *dest, Py_ssize_t size);
+// same for a char buffer of size bytes
+bool _cp1252ToChars(PyObject *str, char *dest, Py_ssize_t size);
+
+// decodes up to the terminator or len characters, whatever comes first;
+// replace uses U+FFFD for the five bytes cp1252 leaves undefined, otherwise they raise
+PyObject *_cp1252FromCells(const cell *src, Py_ssize_t len, bool replace);
+PyObject *_cp1252FromChars(const char *src, Py_ssize_t len, bool replace);
+// string argument of a callback, packed or unpacked, read in place
+PyObject *_cp1252FromAMX(AMX *amx, cell amx_addr, bool replace);
+
+#endif
@@ -0,0 +1,249 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "pythonplugin.h"
+#include "pysamp.h"
+#include "gilpriority.h"
+#include <frameobject.h>
+
+// GIL priority mode: a thread holding the GIL only drops it at an eval-breaker check
+// after a waiting thread asked it to, and a waiter only asks once the switch interval
+// ran out. So while the server thread waits, the interval has to be tight. Threads
+// started with samp.start_thread also hand the GIL over at their next call, and then
+// sleep until the server thread got it.
+bool m_gilPriority = false;
+volatile long m_gilServerWaiting = 0;
+
+unsigned long m_gilIntervalTight = GIL_INTERVAL_TIGHT;
+unsigned long m_gilIntervalRelaxed = GIL_INTERVAL_RELAXED;
+
+// set whenever the server thread isn't waiting for the GIL
+static Event m_gilServerDone;
+
+// Before 3.12 the waiting server thread tightens the interval itself, and relaxes it
+// once it has the GIL. Since 3.12 the interval is per interpreter and can only be
+// changed with an attached thread state, which a thread waiting for the GIL doesn't
+// have, so set_gil_priority keeps it tight for as long as priority mode is on.
+#if PY_VERSION_HEX < 0x030C0000
+	#define GIL_SET_INTERVAL_UNLOCKED	1
+#else
+	#define GIL_SET_INTERVAL_UNLOCKED	0
+#endif
+
+bool _gilServerWait()
+{
+	if (!m_gilPriority) return false;
+
+	if (_atomicInc(m_gilServerWaiting) == 1)
+	{
+		m_gilServerDone.Reset();
+#if GIL_SET_INTERVAL_UNLOCKED
+		_PyEval_SetSwitchInterval(m_gilIntervalTight);
+#endif
+	}
+	return true;
+}
+void _gilServerAcquired(bool waited)
+{
+	if (!waited) return;
+
+	if (_atomicDec(m_gilServerWaiting) == 0)
+	{
+#if GIL_SET_INTERVAL_UNLOCKED
+		_PyEval_SetSwitchInterval(m_gilIntervalRelaxed);
+#endif
+		m_gilServerDone.Set();
+	}
+}
+
+// profiler a thread had when the yield hook was installed, e.g. one from
+// threading.setprofile; the hook's profile object is a capsule of it
+struct gil_profile_chain
+{
+	Py_tracefunc func;
+	PyObject *obj;
+};
+
+static void _gilChainFree(PyObject *capsule)
+{
+	gil_profile_chain *chain = (gil_profile_chain *)PyCapsule_GetPointer(capsule, NULL);
+	Py_XDECREF(chain->obj);
+	PyMem_Free(chain);
+}
+
+// profile hook of threads started with start_thread; gives up the GIL while the server
+// thread waits for it. Only runs on calls, loops without any are left to the interval.
+// obj is NULL, or the capsule of the profiler it replaced, which is called first.
+static int _gilYieldHook(PyObject *obj, PyFrameObject *frame, int what, PyObject *arg)
+{
+	if (obj != NULL)
+	{
+		gil_profile_chain *chain = (gil_profile_chain *)PyCapsule_GetPointer(obj, NULL);
+		if (chain->func(chain->obj, frame, what, arg) == -1)
+			return -1;
+	}
+
+	if (m_gilServerWaiting > 0)
+	{
+		PyThreadState *tstate = PyEval_SaveThread();
+		// don't take it back before the server thread got it
+		m_gilServerDone.Wait();
+		PyEval_RestoreThread(tstate);
+	}
+	return 0;
+}
+
+// entry point of threads started with start_thread: _thread_main(target, args, kwargs)
+static PyObject *_gilThreadMain(PyObject *self, PyObject *args)
+{
+	PyObject *target, *targs, *tkwargs;
+	if (!PyArg_ParseTuple(args, "OOO", &target, &targs, &tkwargs))
+		return NULL;
+
+	PyThreadState *tstate = PyThreadState_Get();
+	PyObject *capsule = NULL;
+	if (tstate->c_profilefunc != NULL)
+	{
+		gil_profile_chain *chain = (gil_profile_chain *)PyMem_Malloc(sizeof(gil_profile_chain));
+		if (chain == NULL)
+			return PyErr_NoMemory();
+		chain->func = tstate->c_profilefunc;
+		chain->obj = tstate->c_profileobj;
+		Py_XINCREF(chain->obj);
+		capsule = PyCapsule_New(chain, NULL, _gilChainFree);
+		if (capsule == NULL)
+		{
+			Py_XDECREF(chain->obj);
+			PyMem_Free(chain);
+			return NULL;
+		}
+	}
+
+	PyEval_SetProfile(_gilYieldHook, capsule);
+	PyObject *ret = PyObject_Call(target, targs, tkwargs == Py_None ? NULL : tkwargs);
+
+	// put the previous profiler back, unless the target replaced the hook with its own
+	if (tstate->c_profilefunc == _gilYieldHook)
+	{
+		if (capsule != NULL)
+		{
+			gil_profile_chain *chain = (gil_profile_chain *)PyCapsule_GetPointer(capsule, NULL);
+			PyEval_SetProfile(chain->func, chain->obj);
+		}
+		else
+			PyEval_SetProfile(NULL, NULL);
+	}
+	Py_XDECREF(capsule);
+	return ret;
+}
+static PyMethodDef _gilThreadMainDef = { "_thread_main", _gilThreadMain, METH_VARARGS, NULL };
+
+// set_gil_priority(enabled, tight = 0.0002, relaxed = 0.005)
+// intervals are given in seconds, just like sys.setswitchinterval
+PyObject *sSetGilPriority(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	int enabled;
+	double tight = GIL_INTERVAL_TIGHT / 1000000.0, relaxed = GIL_INTERVAL_RELAXED / 1000000.0;
+	_pyParseFast(args, nargs, "p|dd", &enabled, &tight, &relaxed);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	if (tight <= 0.0 || relaxed <= 0.0)
+	{
+		PyErr_SetString(PyExc_ValueError, "switch intervals must be positive");
+		return NULL;
+	}
+
+#ifdef Py_GIL_DISABLED
+	// nothing to hand over without a GIL
+	if (enabled)
+		logprintf("PYTHON: set_gil_priority has no effect in free-threaded builds");
+	Py_RETURN_NONE;
+#else
+	m_gilIntervalTight = (unsigned long)(tight * 1000000.0);
+	m_gilIntervalRelaxed = (unsigned long)(relaxed * 1000000.0);
+	m_gilPriority = enabled != 0;
+
+	PyObject *sys = PyImport_ImportModule("sys");
+	if (sys == NULL)
+		return NULL;
+
+#if GIL_SET_INTERVAL_UNLOCKED
+	PyObject *r = PyObject_CallMethod(sys, "setswitchinterval", "d", relaxed);
+#else
+	PyObject *r = PyObject_CallMethod(sys, "setswitchinterval", "d", m_gilPriority ? tight : relaxed);
+#endif
+	Py_DECREF(sys);
+	if (r == NULL)
+		return NULL;
+
+	Py_DECREF(r);
+	Py_RETURN_NONE;
+#endif
+}
+
+// start_thread(target, args = (), kwargs = None)
+// starts a daemon thread that yields to the server thread while priority mode is enabled;
+// subinterpreters don't allow daemon threads, so there it is a normal thread which has to exit in OnPyExit.
+// The yielding is done by a profile function (sys.setprofile) which calls the profiler the
+// thread already had, so sys.getprofile() returns the hook's capsule there. A profiler the
+// target installs itself (cProfile, yappi) replaces it, and the thread doesn't yield for
+// the rest of its run.
+PyObject *sStartThread(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	PyObject *target, *targs = NULL, *tkwargs = Py_None;
+	_pyParseFast(args, nargs, "O|O!O", &target, &PyTuple_Type, &targs, &tkwargs);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	PyObject *threading = PyImport_ImportModule("threading");
+	if (threading == NULL)
+		return NULL;
+
+	PyObject *cls = PyObject_GetAttrString(threading, "Thread");
+	PyObject *main = PyCFunction_New(&_gilThreadMainDef, NULL);
+	PyObject *noargs = PyTuple_New(0);
+	PyObject *kwargs = NULL, *thread = NULL;
+	if (cls != NULL && main != NULL && noargs != NULL)
+	{
+		// Thread(target = ..., args = ..., daemon = ...), all of them as keywords
+		kwargs = Py_BuildValue("{s:O,s:(OOO),s:O}",
+			"target", main,
+			"args", target, targs ? targs : noargs, tkwargs,
+			"daemon", _pyIsMainInterp() ? Py_True : Py_False);
+	}
+	if (kwargs != NULL)
+		thread = PyObject_Call(cls, noargs, kwargs);
+	Py_XDECREF(kwargs);
+	Py_XDECREF(cls);
+	Py_XDECREF(main);
+	Py_XDECREF(noargs);
+	Py_DECREF(threading);
+
+	if (thread == NULL)
+		return NULL;
+
+	PyObject *r = PyObject_CallMethod(thread, "start", NULL);
+	if (r == NULL)
+	{
+		Py_DECREF(thread);
+		return NULL;
+	}
+	Py_DECREF(r);
+	return thread;
+}
@@ -0,0 +1,34 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __gilpriority_h_
+#define __gilpriority_h_
+
+// default switch intervals in microseconds
+#define GIL_INTERVAL_TIGHT		200
+#define GIL_INTERVAL_RELAXED	5000
+
+extern bool m_gilPriority;
+extern volatile long m_gilServerWaiting;
+
+// called by the server thread right before / after PyGILState_Ensure
+bool _gilServerWait();
+void _gilServerAcquired(bool waited);
+
+PyObject *sSetGilPriority(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sStartThread(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+
+#endif
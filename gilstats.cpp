@@ -0,0 +1,179 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "pythonplugin.h"
+#include "pysamp.h"
+#include "gilstats.h"
+
+// one histogram per function using PyEnsureGIL, plus one for whole server ticks
+gil_histogram m_gilHist[MAX_GIL_HISTOGRAMS];
+int m_gilHistCount = 0;
+gil_histogram m_gilTickHist = { "tick" };
+
+// time spent waiting for / holding the GIL since the last tick
+unsigned long long m_gilTickWait = 0, m_gilTickHold = 0;
+bool m_gilTickUsed = false;
+
+Mutex m_gilStatsLock;
+bool m_gilStatsEnabled = false;
+
+static int _gilBucket(unsigned long long us)
+{
+	int b = 0;
+	while (us > 0 && b < GIL_HIST_BUCKETS - 1)
+	{
+		us >>= 1;
+		b++;
+	}
+	return b;
+}
+
+static void _gilAdd(gil_histogram *hist, unsigned long long wait, unsigned long long hold)
+{
+	hist->count++;
+	hist->wait_total += wait;
+	hist->hold_total += hold;
+	hist->wait[_gilBucket(wait)]++;
+	hist->hold[_gilBucket(hold)]++;
+}
+
+gil_histogram *_gilRegister(const char *name)
+{
+	// skip the n_ prefix of the callback natives
+	if (name[0] == 'n' && name[1] == '_') name += 2;
+
+	gil_histogram *hist = NULL;
+	m_gilStatsLock.Lock();
+	if (m_gilHistCount < MAX_GIL_HISTOGRAMS)
+	{
+		hist = &m_gilHist[m_gilHistCount++];
+		memset(hist, 0, sizeof(gil_histogram));
+		hist->name = name;
+	}
+	m_gilStatsLock.Unlock();
+	return hist;
+}
+
+void _gilRecord(gil_histogram *hist, unsigned long long wait, unsigned long long hold)
+{
+	m_gilStatsLock.Lock();
+	if (hist != NULL) _gilAdd(hist, wait, hold);
+
+	m_gilTickWait += wait;
+	m_gilTickHold += hold;
+	m_gilTickUsed = true;
+	m_gilStatsLock.Unlock();
+}
+
+// called once per server tick; adds everything recorded since the last tick to the tick histogram
+void _gilTick()
+{
+	if (!m_gilStatsEnabled)
+		return;
+
+	m_gilStatsLock.Lock();
+	if (m_gilTickUsed)
+	{
+		_gilAdd(&m_gilTickHist, m_gilTickWait, m_gilTickHold);
+		m_gilTickWait = m_gilTickHold = 0;
+		m_gilTickUsed = false;
+	}
+	m_gilStatsLock.Unlock();
+}
+
+static PyObject *_gilBuckets(unsigned long long *buckets)
+{
+	PyObject *list = PyList_New(GIL_HIST_BUCKETS);
+	for (int i = 0; i < GIL_HIST_BUCKETS; i++)
+		PyList_SET_ITEM(list, i, PyLong_FromUnsignedLongLong(buckets[i]));
+	return list;
+}
+
+static PyObject *_gilHistToDict(gil_histogram *hist)
+{
+	return Py_BuildValue("{s:K,s:K,s:K,s:N,s:N}",
+		"count", hist->count,
+		"wait_total", hist->wait_total,
+		"hold_total", hist->hold_total,
+		"wait", _gilBuckets(hist->wait),
+		"hold", _gilBuckets(hist->hold));
+}
+
+// enable_gil_stats(enabled)
+// the histograms keep their counts while disabled, reset_gil_stats clears them
+PyObject *sEnableGilStats(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	int enabled;
+	_pyParseFast(args, nargs, "p", &enabled);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	m_gilStatsEnabled = enabled != 0;
+	Py_RETURN_NONE;
+}
+
+// gil_stats()
+// returns { name: { count, wait_total, hold_total, wait, hold } }, all times in microseconds;
+// wait and hold are histograms where bucket i counts durations below 2^i us
+PyObject *sGilStats(PyObject *self, PyObject *args)
+{
+	PyObject *ret = PyDict_New();
+	if (ret == NULL)
+		return NULL;
+
+	// work on a copy, so we don't call into Python while holding the lock
+	gil_histogram hist[MAX_GIL_HISTOGRAMS + 1];
+	int count;
+
+	m_gilStatsLock.Lock();
+	count = m_gilHistCount;
+	memcpy(hist, m_gilHist, count * sizeof(gil_histogram));
+	hist[count++] = m_gilTickHist;
+	m_gilStatsLock.Unlock();
+
+	for (int i = 0; i < count; i++)
+	{
+		PyObject *d = _gilHistToDict(&hist[i]);
+		if (d == NULL || PyDict_SetItemString(ret, hist[i].name, d) == -1)
+		{
+			Py_XDECREF(d);
+			Py_DECREF(ret);
+			return NULL;
+		}
+		Py_DECREF(d);
+	}
+	return ret;
+}
+
+// reset_gil_stats()
+PyObject *sResetGilStats(PyObject *self, PyObject *args)
+{
+	m_gilStatsLock.Lock();
+	for (int i = 0; i < m_gilHistCount; i++)
+	{
+		const char *name = m_gilHist[i].name;
+		memset(&m_gilHist[i], 0, sizeof(gil_histogram));
+		m_gilHist[i].name = name;
+	}
+	memset(&m_gilTickHist, 0, sizeof(gil_histogram));
+	m_gilTickHist.name = "tick";
+	m_gilTickWait = m_gilTickHold = 0;
+	m_gilTickUsed = false;
+	m_gilStatsLock.Unlock();
+
+	Py_RETURN_NONE;
+}
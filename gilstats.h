@@ -0,0 +1,45 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __gilstats_h_
+#define __gilstats_h_
+
+// bucket i counts durations below 2^i microseconds, the last one everything above
+#define GIL_HIST_BUCKETS	24
+#define MAX_GIL_HISTOGRAMS	64
+
+struct gil_histogram
+{
+	const char *name;
+	unsigned long long count;
+	unsigned long long wait_total;
+	unsigned long long hold_total;
+	unsigned long long wait[GIL_HIST_BUCKETS];
+	unsigned long long hold[GIL_HIST_BUCKETS];
+};
+
+// off by default, so PyEnsureGIL doesn't read the clock or take m_gilStatsLock
+extern bool m_gilStatsEnabled;
+
+gil_histogram *_gilRegister(const char *name);
+void _gilRecord(gil_histogram *hist, unsigned long long wait, unsigned long long hold);
+void _gilTick();
+
+PyObject *sEnableGilStats(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sGilStats(PyObject *self, PyObject *args);
+PyObject *sResetGilStats(PyObject *self, PyObject *args);
+
+#endif
@@ -69,4 +69,67 @@ void Mutex::Unlock()
 #else
 	pthread_mutex_unlock(&m_Mutex);
 #endif
-}
\ No newline at end of file
+}
+
+Event::Event()
+{
+	m_Set = false;
+#ifdef _WIN32
+	InitializeCriticalSection(&m_Lock);
+	InitializeConditionVariable(&m_Cond);
+#else
+	pthread_mutex_init(&m_Lock, NULL);
+	pthread_cond_init(&m_Cond, NULL);
+#endif
+}
+Event::~Event()
+{
+#ifdef _WIN32
+	DeleteCriticalSection(&m_Lock);
+#else
+	pthread_cond_destroy(&m_Cond);
+	pthread_mutex_destroy(&m_Lock);
+#endif
+}
+
+void Event::Set()
+{
+#ifdef _WIN32
+	EnterCriticalSection(&m_Lock);
+	m_Set = true;
+	LeaveCriticalSection(&m_Lock);
+	WakeAllConditionVariable(&m_Cond);
+#else
+	pthread_mutex_lock(&m_Lock);
+	m_Set = true;
+	pthread_cond_broadcast(&m_Cond);
+	pthread_mutex_unlock(&m_Lock);
+#endif
+}
+void Event::Reset()
+{
+#ifdef _WIN32
+	EnterCriticalSection(&m_Lock);
+	m_Set = false;
+	LeaveCriticalSection(&m_Lock);
+#else
+	pthread_mutex_lock(&m_Lock);
+	m_Set = false;
+	pthread_mutex_unlock(&m_Lock);
+#endif
+}
+void Event::Wait()
+{
+	// loop, condition variables may wake up spuriously
+#ifdef _WIN32
+	EnterCriticalSection(&m_Lock);
+	while (!m_Set)
+		SleepConditionVariableCS(&m_Cond, &m_Lock, INFINITE);
+	LeaveCriticalSection(&m_Lock);
+#else
+	pthread_mutex_lock(&m_Lock);
+	while (!m_Set)
+		pthread_cond_wait(&m_Cond, &m_Lock);
+	pthread_mutex_unlock(&m_Lock);
+#endif
+}
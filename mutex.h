@@ -29,4 +29,26 @@ public:
 
 	void Lock();
 	void Unlock();
+};
+
+// flag other threads can wait for until it is set; built on a condition variable
+class Event
+{
+private:
+	bool m_Set;
+	#ifdef _WIN32
+		CRITICAL_SECTION m_Lock;
+		CONDITION_VARIABLE m_Cond;
+	#else
+		pthread_mutex_t m_Lock;
+		pthread_cond_t m_Cond;
+	#endif
+
+public:
+	Event();
+	~Event();
+
+	void Set();
+	void Reset();
+	void Wait();
 };
\ No newline at end of file
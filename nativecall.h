@@ -0,0 +1,333 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef __native_call_h_
+#define __native_call_h_
+
+//-----------------------------------------
+// marshalling for the natives declared in nativesignatures.h
+//
+// every parameter kind is a struct with
+//   py    - number of Python arguments it takes (0 or 1)
+//   opt   - whether that argument may be left out
+//   cells - number of AMX params it fills
+//   outs  - number of out params it adds to native_call::out
+//   in()  - converts it; returns false with a Python exception set on errors
+// every return kind has get(), which builds the Python return value
+//-----------------------------------------
+
+#define MAX_NATIVE_PARAMS	16
+#define MAX_NATIVE_OUTS		4
+
+struct native_out
+{
+	cell *addr;
+	PyObject *(*get)(cell *addr);
+};
+
+struct native_call
+{
+	PyObject *self;		// the samp module of the calling interpreter
+	PyObject *const *args;
+	Py_ssize_t nargs;
+	Py_ssize_t pyarg;	// next Python argument
+	int param;			// last AMX param filled
+	cell params[MAX_NATIVE_PARAMS + 1];
+	scratch_mark mark;	// strings and out params are carved from the scratch arena
+	int outs;
+	native_out out[MAX_NATIVE_OUTS];
+
+	PyObject *next() { return args[pyarg++]; }
+	bool more() { return pyarg < nargs; }
+	void push(cell value) { params[++param] = value; }
+
+	// allots cells on the AMX heap and pushes their address
+	cell *allot(int cells) { return _scratchAllot(cells, &params[++param]); }
+	bool addOut(PyObject *(*get)(cell *addr))
+	{
+		cell *addr = allot(1);
+		if (addr == NULL) return false;
+		*addr = 0;
+		out[outs].addr = addr;
+		out[outs++].get = get;
+		return true;
+	}
+};
+
+void _nativeArgCountError(const char *name, int min, int max, Py_ssize_t given);
+PyObject *_nativeDict(native_call &c, const char **keys, int count);
+PyObject *_nativeStruct(native_call &c, PyTypeObject *type);
+PyObject *_amxStringToPy(cell *addr, int size);
+void _textdrawChanged(cell playerid, cell textdraw);
+
+//-----------------------------------------
+// parameter kinds
+//-----------------------------------------
+
+struct p_int
+{
+	enum { py = 1, opt = 0, cells = 1, outs = 0 };
+	static bool in(native_call &c)
+	{
+		long v = PyLong_AsLong(c.next());
+		if (v == -1 && PyErr_Occurred()) return false;
+		c.push(v);
+		return true;
+	}
+};
+template <int D> struct opt_int
+{
+	enum { py = 1, opt = 1, cells = 1, outs = 0 };
+	static bool in(native_call &c)
+	{
+		if (!c.more())
+		{
+			c.push(D);
+			return true;
+		}
+		return p_int::in(c);
+	}
+};
+
+struct p_float
+{
+	enum { py = 1, opt = 0, cells = 1, outs = 0 };
+	static bool in(native_call &c)
+	{
+		float v = (float)PyFloat_AsDouble(c.next());
+		if (v == -1.0f && PyErr_Occurred()) return false;
+		c.push(amx_ftoc(v));
+		return true;
+	}
+};
+template <int D> struct opt_float
+{
+	enum { py = 1, opt = 1, cells = 1, outs = 0 };
+	static bool in(native_call &c)
+	{
+		if (!c.more())
+		{
+			float v = (float)D;
+			c.push(amx_ftoc(v));
+			return true;
+		}
+		return p_float::in(c);
+	}
+};
+
+// int 0xRRGGBBAA or tuple (r, g, b, a)
+struct p_color
+{
+	enum { py = 1, opt = 0, cells = 1, outs = 0 };
+	// 0xRRGGBBAA or an (r, g, b, a) tuple
+	static bool convert(PyObject *o, cell *color)
+	{
+		if (PyTuple_Check(o))
+		{
+			unsigned char r, g, b, a;
+			if (!PyArg_ParseTuple(o, "bbbb", &r, &g, &b, &a)) return false;
+			*color = (cell)(((unsigned int)r << 24) | ((unsigned int)g << 16) | ((unsigned int)b << 8) | a);
+			return true;
+		}
+		long long v = PyLong_AsLongLong(o);
+		if (v == -1 && PyErr_Occurred()) return false;
+		*color = (cell)(v & 0xFFFFFFFF);
+		return true;
+	}
+	static bool in(native_call &c)
+	{
+		cell color;
+		if (!convert(c.next(), &color)) return false;
+		c.push(color);
+		return true;
+	}
+};
+
+// str, encoded to cp1252
+struct p_string
+{
+	enum { py = 1, opt = 0, cells = 1, outs = 0 };
+	static bool in(native_call &c)
+	{
+		PyObject *str = c.next();
+		Py_ssize_t size = _cp1252Size(str);
+		if (size == -1) return false;
+
+		cell *addr = c.allot((int)size);
+		return addr != NULL && _cp1252ToCells(str, addr, size);
+	}
+};
+
+// id of a textdraw whose look is changed by a setter the textdraw shadow doesn't
+// track (textdraws.cpp); the next show of it can't be dropped
+struct p_textdraw
+{
+	enum { py = 1, opt = 0, cells = 1, outs = 0 };
+	static bool in(native_call &c)
+	{
+		if (!p_int::in(c)) return false;
+		_textdrawChanged(-1, c.params[c.param]);
+		return true;
+	}
+};
+// the same for player textdraws, follows the playerid
+struct p_player_textdraw
+{
+	enum { py = 1, opt = 0, cells = 1, outs = 0 };
+	static bool in(native_call &c)
+	{
+		if (!p_int::in(c)) return false;
+		_textdrawChanged(c.params[c.param - 1], c.params[c.param]);
+		return true;
+	}
+};
+
+struct o_int
+{
+	enum { py = 0, opt = 0, cells = 1, outs = 1 };
+	static PyObject *get(cell *addr) { return PyLong_FromLong(*addr); }
+	static bool in(native_call &c) { return c.addOut(get); }
+};
+
+struct o_float
+{
+	enum { py = 0, opt = 0, cells = 1, outs = 1 };
+	static PyObject *get(cell *addr) { return PyFloat_FromDouble(amx_ctof(*addr)); }
+	static bool in(native_call &c) { return c.addOut(get); }
+};
+
+// string buffer of N cells, followed by its size
+template <int N> struct o_string
+{
+	enum { py = 0, opt = 0, cells = 2, outs = 1 };
+	static PyObject *get(cell *addr) { return _amxStringToPy(addr, N); }
+	static bool in(native_call &c)
+	{
+		cell *addr = c.allot(N);
+		if (addr == NULL) return false;
+		addr[0] = 0;
+		c.out[c.outs].addr = addr;
+		c.out[c.outs++].get = get;
+		c.push(N);
+		return true;
+	}
+};
+
+//-----------------------------------------
+// return kinds
+//-----------------------------------------
+
+struct r_none
+{
+	static PyObject *get(native_call &c, cell ret) { Py_RETURN_NONE; }
+};
+struct r_int
+{
+	static PyObject *get(native_call &c, cell ret) { return PyLong_FromLong(ret); }
+};
+struct r_float
+{
+	static PyObject *get(native_call &c, cell ret) { return PyFloat_FromDouble(amx_ctof(ret)); }
+};
+// value of the only out param
+struct r_out
+{
+	static PyObject *get(native_call &c, cell ret) { return c.out[0].get(c.out[0].addr); }
+};
+
+// dict of all out params
+#define NATIVE_DICT(kind, ...) \
+	struct kind \
+	{ \
+		static PyObject *get(native_call &c, cell ret) \
+		{ \
+			static const char *keys[] = { __VA_ARGS__ }; \
+			return _nativeDict(c, keys, sizeof(keys) / sizeof(keys[0])); \
+		} \
+	};
+
+// samp.Vec3 / samp.Quat of all out params
+struct r_vec3
+{
+	static PyObject *get(native_call &c, cell ret) { return _nativeStruct(c, _pyVec3Type(c.self)); }
+};
+struct r_quat
+{
+	static PyObject *get(native_call &c, cell ret) { return _nativeStruct(c, _pyQuatType(c.self)); }
+};
+
+NATIVE_DICT(r_keys, "keys", "updown", "leftright")
+NATIVE_DICT(r_time, "hour", "minute")
+NATIVE_DICT(r_weapon, "weapons", "ammo")
+NATIVE_DICT(r_damage, "panels", "doors", "lights", "tires")
+
+//-----------------------------------------
+// the call itself
+//-----------------------------------------
+
+template <class... K> struct native_params;
+template <> struct native_params<>
+{
+	enum { py = 0, opt = 0, cells = 0, outs = 0 };
+	static bool in(native_call &c) { return true; }
+};
+template <class K, class... R> struct native_params<K, R...>
+{
+	enum
+	{
+		py = K::py + native_params<R...>::py,
+		opt = K::opt + native_params<R...>::opt,
+		cells = K::cells + native_params<R...>::cells,
+		outs = K::outs + native_params<R...>::outs
+	};
+	static bool in(native_call &c) { return K::in(c) && native_params<R...>::in(c); }
+};
+
+// called by METH_FASTCALL wrappers, reads the argument vector directly
+template <class R, class... K>
+PyObject *_nativeCall(const char *name, amx_function_t func, PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	typedef native_params<K...> P;
+	static_assert(P::cells <= MAX_NATIVE_PARAMS, "too many params, raise MAX_NATIVE_PARAMS");
+	static_assert(P::outs <= MAX_NATIVE_OUTS, "too many out params, raise MAX_NATIVE_OUTS");
+
+	if (nargs < P::py - P::opt || nargs > P::py)
+	{
+		_nativeArgCountError(name, P::py - P::opt, P::py, nargs);
+		return NULL;
+	}
+
+	native_call c;
+	c.self = self;
+	c.args = args;
+	c.nargs = nargs;
+	c.pyarg = 0;
+	c.param = 0;
+	c.mark = _scratchMark();
+	c.outs = 0;
+
+	PyObject *ret = NULL;
+	if (P::in(c))
+	{
+		c.params[0] = c.param * sizeof(cell);
+		ret = R::get(c, func(m_AMX, c.params));
+	}
+	_scratchRelease(c.mark);
+	return ret;
+}
+
+#endif
@@ -0,0 +1,268 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "pythonplugin.h"
+#include "pysamp.h"
+#include "nativeprofile.h"
+
+// calls and time per (native, calling module): open addressing with linear probing on
+// FNV-1a hashes of both names. Once it is 3/4 full, calls of new pairs are only counted
+// as dropped.
+struct native_profile_entry
+{
+	unsigned int hash;
+	unsigned long long calls;	// 0 marks a free slot
+	unsigned long long time;	// nanoseconds
+	char native[sNAMEMAX + 1];
+	char module[PROFILE_MODULE_LEN];
+};
+
+bool m_nativeProfiling = false;
+
+static native_profile_entry m_nativeProfile[NATIVE_PROFILE_SIZE];
+static int m_nativeProfileCount = 0;
+static unsigned long long m_nativeProfileDropped = 0;
+static Mutex m_nativeProfileLock;
+
+// copies at most size - 1 bytes, without cutting a UTF-8 sequence in half
+static void _profileCopy(char *dest, const char *src, size_t size)
+{
+	size_t len = strlen(src);
+	if (len >= size)
+	{
+		len = size - 1;
+		while (len > 0 && ((unsigned char)src[len] & 0xC0) == 0x80)
+			len--;
+	}
+	memcpy(dest, src, len);
+	dest[len] = '\0';
+}
+
+static unsigned int _profileHash(unsigned int hash, const char *str)
+{
+	for (; *str; str++)
+		hash = (hash ^ (unsigned char)*str) * 16777619u;
+	return hash;
+}
+
+// __name__ of the module whose code called the native. Natives the plugin calls on its
+// own, like the player snapshot in ProcessTick, run without a thread state or frame.
+static const char *_profileCaller()
+{
+#if PY_VERSION_HEX >= 0x030D0000
+	if (PyThreadState_GetUnchecked() == NULL)
+#else
+	if (_PyThreadState_UncheckedGet() == NULL)
+#endif
+		return "<plugin>";
+
+	PyObject *globals = PyEval_GetGlobals();
+	PyObject *name = globals != NULL ? PyDict_GetItemString(globals, "__name__") : NULL;
+	if (name == NULL || !PyUnicode_Check(name))
+		return "<plugin>";
+
+	const char *str = PyUnicode_AsUTF8(name);
+	if (str == NULL)
+	{
+		PyErr_Clear();
+		return "<plugin>";
+	}
+	return str;
+}
+
+static void _profileAdd(const char *native, const char *module, unsigned long long time)
+{
+	char n[sNAMEMAX + 1], m[PROFILE_MODULE_LEN];
+	_profileCopy(n, native, sizeof(n));
+	_profileCopy(m, module, sizeof(m));
+	unsigned int hash = _profileHash(_profileHash(2166136261u, n) * 16777619u, m);
+
+	m_nativeProfileLock.Lock();
+	for (unsigned int i = hash;; i++)
+	{
+		native_profile_entry *e = &m_nativeProfile[i & (NATIVE_PROFILE_SIZE - 1)];
+		if (e->calls == 0)
+		{
+			if (m_nativeProfileCount >= NATIVE_PROFILE_SIZE * 3 / 4)
+			{
+				m_nativeProfileDropped++;
+				break;
+			}
+			e->hash = hash;
+			memcpy(e->native, n, sizeof(n));
+			memcpy(e->module, m, sizeof(m));
+			m_nativeProfileCount++;
+		}
+		else if (e->hash != hash || strcmp(e->native, n) != 0 || strcmp(e->module, m) != 0)
+			continue;
+
+		e->calls++;
+		e->time += time;
+		break;
+	}
+	m_nativeProfileLock.Unlock();
+}
+
+int _nativeProfiled(const char *name, amx_function_t func, AMX *amx, cell *params)
+{
+	unsigned long long start = GetNanoTickCount();
+	int ret = func(amx, params);
+	unsigned long long time = GetNanoTickCount() - start;
+
+	_profileAdd(name, _profileCaller(), time);
+	return ret;
+}
+
+static int _profileCompare(const void *a, const void *b)
+{
+	unsigned long long ta = ((const native_profile_entry *)a)->time, tb = ((const native_profile_entry *)b)->time;
+	return ta < tb ? 1 : (ta > tb ? -1 : 0);
+}
+
+// copy of the used entries, most total time first; the caller frees it with PyMem_Free
+static native_profile_entry *_profileSorted(int *count, unsigned long long *dropped)
+{
+	native_profile_entry *entries = (native_profile_entry *)PyMem_Malloc(NATIVE_PROFILE_SIZE * sizeof(native_profile_entry));
+	if (entries == NULL)
+	{
+		PyErr_NoMemory();
+		return NULL;
+	}
+
+	int n = 0;
+	m_nativeProfileLock.Lock();
+	for (int i = 0; i < NATIVE_PROFILE_SIZE; i++)
+	{
+		if (m_nativeProfile[i].calls != 0)
+			entries[n++] = m_nativeProfile[i];
+	}
+	*dropped = m_nativeProfileDropped;
+	m_nativeProfileLock.Unlock();
+
+	qsort(entries, n, sizeof(native_profile_entry), _profileCompare);
+	*count = n;
+	return entries;
+}
+
+// profile_natives(enabled)
+// while enabled, every native call is counted and timed per calling module
+PyObject *sProfileNatives(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	int enabled;
+	_pyParseFast(args, nargs, "p", &enabled);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	if ((enabled != 0) != m_nativeProfiling)
+	{
+		m_nativeProfiling = enabled != 0;
+		_nativeProfileSlots(m_nativeProfiling);
+	}
+	Py_RETURN_NONE;
+}
+
+// native_profile()
+// returns [(native, module, calls, total_us)], most total time first
+PyObject *sNativeProfile(PyObject *self, PyObject *args)
+{
+	int count;
+	unsigned long long dropped;
+	native_profile_entry *entries = _profileSorted(&count, &dropped);
+	if (entries == NULL)
+		return NULL;
+
+	PyObject *ret = PyList_New(count);
+	for (int i = 0; ret != NULL && i < count; i++)
+	{
+		PyObject *t = Py_BuildValue("(ssKd)", entries[i].native, entries[i].module,
+			entries[i].calls, entries[i].time / 1000.0);
+		if (t == NULL)
+			Py_CLEAR(ret);
+		else
+			PyList_SET_ITEM(ret, i, t);
+	}
+	PyMem_Free(entries);
+	return ret;
+}
+
+// dump_native_profile(path = None)
+// writes the profile as a table to the server log, or to the file at path
+PyObject *sDumpNativeProfile(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	char *path = NULL;
+	_pyParseFast(args, nargs, "|s", &path);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	FILE *file = NULL;
+	if (path != NULL)
+	{
+		file = fopen(path, "w");
+		if (file == NULL)
+			return PyErr_SetFromErrnoWithFilename(PyExc_OSError, path);
+	}
+
+	int count;
+	unsigned long long dropped;
+	native_profile_entry *entries = _profileSorted(&count, &dropped);
+	if (entries == NULL)
+	{
+		if (file != NULL) fclose(file);
+		return NULL;
+	}
+
+	unsigned long long calls = 0, time = 0;
+	for (int i = 0; i < count; i++)
+	{
+		calls += entries[i].calls;
+		time += entries[i].time;
+	}
+
+	char line[256];
+	for (int i = -2; i < count; i++)
+	{
+		if (i == -2)
+			PyOS_snprintf(line, sizeof(line), "native profile: %llu calls, %.3f ms total, %llu calls not counted",
+				calls, time / 1000000.0, dropped);
+		else if (i == -1)
+			PyOS_snprintf(line, sizeof(line), "%-32s %-32s %10s %12s %10s", "native", "module", "calls", "total ms", "avg us");
+		else
+			PyOS_snprintf(line, sizeof(line), "%-32s %-32s %10llu %12.3f %10.3f", entries[i].native, entries[i].module,
+				entries[i].calls, entries[i].time / 1000000.0, entries[i].time / 1000.0 / entries[i].calls);
+
+		if (file != NULL)
+			fprintf(file, "%s\n", line);
+		else
+			logprintf("PYTHON: %s", line);
+	}
+	PyMem_Free(entries);
+	if (file != NULL) fclose(file);
+	Py_RETURN_NONE;
+}
+
+// reset_native_profile()
+PyObject *sResetNativeProfile(PyObject *self, PyObject *args)
+{
+	m_nativeProfileLock.Lock();
+	memset(m_nativeProfile, 0, sizeof(m_nativeProfile));
+	m_nativeProfileCount = 0;
+	m_nativeProfileDropped = 0;
+	m_nativeProfileLock.Unlock();
+
+	Py_RETURN_NONE;
+}
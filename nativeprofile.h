@@ -0,0 +1,42 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __nativeprofile_h_
+#define __nativeprofile_h_
+
+// (native, calling module) pairs the profiler keeps apart
+#define NATIVE_PROFILE_SIZE		2048
+#define PROFILE_MODULE_LEN		64
+
+extern bool m_nativeProfiling;
+
+int _nativeProfiled(const char *name, amx_function_t func, AMX *amx, cell *params);
+void _nativeProfileSlots(bool enable);
+
+// calls a native that doesn't live in a slot (CallNativeFunction, samp.native);
+// costs one branch while profiling is off
+inline int _nativeInvoke(const char *name, amx_function_t func, AMX *amx, cell *params)
+{
+	if (m_nativeProfiling) return _nativeProfiled(name, func, amx, params);
+	return func(amx, params);
+}
+
+PyObject *sProfileNatives(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sNativeProfile(PyObject *self, PyObject *args);
+PyObject *sDumpNativeProfile(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sResetNativeProfile(PyObject *self, PyObject *args);
+
+#endif
@@ -0,0 +1,604 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Signature table of the natives whose Python wrappers are generated by nativecall.h.
+// NATIVE(name, slot, return kind, parameter kinds...) defines sName, which calls the
+// native through the amx_function_t slot; no include guard, define NATIVE before including it.
+
+// AddMenuItem(Menu:menuid, column, title[]) -- TODO: test
+NATIVE(AddMenuItem, _addMenuItem, r_none, p_int, p_int, p_string)
+// int AddPlayerClass(skin, Float:x, Float:y, Float:z, Float:Angle, weapon1, weapon1_ammo, weapon2, weapon2_ammo, weapon3, weapon3_ammo)
+NATIVE(AddPlayerClass, _addPlayerClass, r_int, p_int, p_float, p_float, p_float, p_float, p_int, p_int, p_int, p_int, p_int, p_int)
+// int AddPlayerClassEx(teamid, skin, Float:x, Float:y, Float:z, Float:Angle, weapon1, weapon1_ammo, weapon2, weapon2_ammo, weapon3, weapon3_ammo) -- TODO: test
+NATIVE(AddPlayerClassEx, _addPlayerClassEx, r_int, p_int, p_int, p_float, p_float, p_float, p_float, p_int, p_int, p_int, p_int, p_int, p_int)
+// int AddStaticPickup(model, type, Float:X, Float:Y, Float:Z, Virtualworld = 0)
+NATIVE(AddStaticPickup, _addStaticPickup, r_int, p_int, p_int, p_float, p_float, p_float, opt_int<0>)
+// int AddStaticVehicle(modelid, Float:spawn_x, Float:spawn_y, Float:spawn_z, Float:angle, color1, color2) -- TODO: test
+NATIVE(AddStaticVehicle, _addStaticVehicle, r_int, p_int, p_float, p_float, p_float, p_float, p_int, p_int)
+// int AddStaticVehicleEx(modelid, Float:spawn_x, Float:spawn_y, Float:spawn_z, Float:angle, color1, color2, respawn_delay) -- TODO: test
+NATIVE(AddStaticVehicleEx, _addStaticVehicleEx, r_int, p_int, p_float, p_float, p_float, p_float, p_int, p_int, p_int)
+// AddVehicleComponent(vehicleid, componentid)
+NATIVE(AddVehicleComponent, _addVehicleComponent, r_none, p_int, p_int)
+// AllowAdminTeleport(allow) -- TOOD: test
+NATIVE(AllowAdminTeleport, _allowAdminTeleport, r_none, p_int)
+// AllowInteriorWeapons(allow) -- TODO: test this function after GivePlayerWeapon is implemented
+NATIVE(AllowInteriorWeapons, _allowInteriorWeapons, r_none, p_int)
+// AllowPlayerTeleport(playerid, allow) -- TODO: test
+NATIVE(AllowPlayerTeleport, _allowPlayerTeleport, r_none, p_int, p_int)
+// ApplyAnimation(playerid, animlib[], animname[], Float:fDelta, loop, lockx, locky, freeze, time, forcesync = 0)
+NATIVE(ApplyAnimation, _applyAnimation, r_none, p_int, p_string, p_string, p_float, p_int, p_int, p_int, p_int, p_int, opt_int<0>)
+// Attach3DTextLabelToPlayer(Text3D:id, playerid, Float:OffsetX, Float:OffsetY, Float:OffsetZ) -- TODO: test
+NATIVE(Attach3DTextLabelToPlayer, _attach3DTextLabelToPlayer, r_none, p_int, p_int, p_float, p_float, p_float)
+// Attach3DTextLabelToVehicle(Text3D:id, vehicleid, Float:OffsetX, Float:OffsetY, Float:OffsetZ) -- TODO: test
+NATIVE(Attach3DTextLabelToVehicle, _attach3DTextLabelToVehicle, r_none, p_int, p_int, p_float, p_float, p_float)
+// AttachCameraToObject(playerid, objectid) -- TODO: test
+NATIVE(AttachCameraToObject, _attachCameraToObject, r_none, p_int, p_int)
+// AttachCameraToPlayerObject(playerid, playerobjectid) -- TODO: test
+NATIVE(AttachCameraToPlayerObject, _attachCameraToPlayerObject, r_none, p_int, p_int)
+// AttachObjectToObject(objectid, attachtoid, Float:OffsetX, Float:OffsetY, Float:OffsetZ, Float:RotX, Float:RotY, Float:RotZ, SyncRotation = 1) -- TODO: test
+NATIVE(AttachObjectToObject, _attachObjectToObject, r_none, p_int, p_int, p_float, p_float, p_float, p_float, p_float, p_float, opt_int<1>)
+// AttachObjectToPlayer(objectid, playerid, Float:OffsetX, Float:OffsetY, Float:OffsetZ, Float:rX, Float:rY, Float:rZ) -- TODO: test
+NATIVE(AttachObjectToPlayer, _attachObjectToPlayer, r_none, p_int, p_int, p_float, p_float, p_float, p_float, p_float, p_float)
+// AttachObjectToVehicle(objectid, vehicleid, Float:fOffsetX, Float:fOffsetY, Float:fOffsetZ, Float:fRotX, Float:fRotY, Float:RotZ) -- TODO: test / 0.3c
+NATIVE(AttachObjectToVehicle, _attachObjectToVehicle, r_none, p_int, p_int, p_float, p_float, p_float, p_float, p_float, p_float)
+// AttachPlayerObjectToPlayer(objectplayer, objectid, attachplayer, Float:OffsetX, Float:OffsetY, Float:OffsetZ, Float:rX, Float:rY, Float:rZ) -- TODO: test
+NATIVE(AttachPlayerObjectToPlayer, _attachPlayerObjectToPlayer, r_none, p_int, p_int, p_int, p_float, p_float, p_float, p_float, p_float, p_float)
+// AttachPlayerObjectToVehicle(playerid, objectid, vehicleid, Float:fOffsetX, Float:fOffsetY, Float:fOffsetZ, Float:fRotX, Float:fRotY, Float:RotZ) -- TODO: test
+NATIVE(AttachPlayerObjectToVehicle, _attachPlayerObjectToVehicle, r_none, p_int, p_int, p_int, p_float, p_float, p_float, p_float, p_float, p_float)
+// AttachTrailerToVehicle(trailerid, vehicleid) -- TODO: test
+NATIVE(AttachTrailerToVehicle, _attachTrailerToVehicle, r_none, p_int, p_int)
+// Ban(playerid)
+NATIVE(Ban, _ban, r_none, p_int)
+// BanEx(playerid, reason[])
+NATIVE(BanEx, _banEx, r_none, p_int, p_string)
+// CancelEdit(playerid) -- TODO: test
+NATIVE(CancelEdit, _cancelEdit, r_none, p_int)
+// CancelSelectTextDraw(playerid) -- TODO: test
+NATIVE(CancelSelectTextDraw, _cancelSelectTextDraw, r_none, p_int)
+// ChangeVehicleColor(vehicleid, color1, color2)
+NATIVE(ChangeVehicleColor, _changeVehicleColor, r_none, p_int, p_int, p_int)
+// ChangeVehiclePaintjob(vehicleid, paintjobid)
+NATIVE(ChangeVehiclePaintjob, _changeVehiclePaintjob, r_none, p_int, p_int)
+// ClearAnimations(playerid)
+NATIVE(ClearAnimations, _clearAnimations, r_none, p_int)
+// ConnectNPC(name[], script[])
+NATIVE(ConnectNPC, _connectNPC, r_none, p_string, p_string)
+// int Create3DTextLabel(text[], color, Float:X, Float:Y, Float:Z, Float:DrawDistance, virtualworld, testLOS)
+NATIVE(Create3DTextLabel, _create3DTextLabel, r_int, p_string, p_color, p_float, p_float, p_float, p_float, p_int, p_int)
+// CreateExplosion(Float:X, Float:Y, Float:Z, type, Float:radius)
+NATIVE(CreateExplosion, _createExplosion, r_none, p_float, p_float, p_float, p_int, p_float)
+// int CreateMenu(title[], columns, Float:x, Float:y, Float:col1width, Float:col2width) -- TODO. test
+NATIVE(CreateMenu, _createMenu, r_int, p_string, p_int, p_float, p_float, p_float, p_float)
+// int CreateObject(modelid, Float:X, Float:Y, Float:Z, Float:rX, Float:rY, Float:rZ, Float:DrawDistance=0.0)
+NATIVE(CreateObject, _createObject, r_int, p_int, p_float, p_float, p_float, p_float, p_float, p_float, opt_float<0>)
+// int CreatePickup(model, type, Float:X, Float:Y, Float:Z, Virtualworld=0) -- TODO: test
+NATIVE(CreatePickup, _createPickup, r_int, p_int, p_int, p_float, p_float, p_float, opt_int<0>)
+// int CreatePlayer3DTextLabel(playerid, text[], color, Float:X, Float:Y, Float:Z, Float:DrawDistance, attachedplayer, attachedvehicle, testLOS) -- TODO: test
+NATIVE(CreatePlayer3DTextLabel, _createPlayer3DTextLabel, r_int, p_int, p_string, p_color, p_float, p_float, p_float, p_float, p_int, p_int, p_int)
+// int CreatePlayerObject(playerid, modelid, Float:X, Float:Y, Float:Z, Float:rX, Float:rY, Float:rZ, Float:DrawDistance=0.0) -- TODO: test
+NATIVE(CreatePlayerObject, _createPlayerObject, r_int, p_int, p_int, p_float, p_float, p_float, p_float, p_float, p_float, opt_float<0>)
+// int CreateVehicle(modelid, Float:x, Float:y, Float:z, Float:angle, color1, color2, respawn_delay)
+NATIVE(CreateVehicle, _createVehicle, r_int, p_int, p_float, p_float, p_float, p_float, p_int, p_int, p_int)
+// int Delete3DTextLabel(Text3D:id) -- TODO: test
+NATIVE(Delete3DTextLabel, _delete3DTextLabel, r_int, p_int)
+// int DeletePVar(playerid, varname[])
+NATIVE(DeletePVar, _deletePVar, r_int, p_int, p_string)
+// int DeletePlayer3DTextLabel(playerid, PlayerText3D:id) -- TODO: test
+NATIVE(DeletePlayer3DTextLabel, _deletePlayer3DTextLabel, r_int, p_int, p_int)
+// int DestroyMenu(Menu:menuid) -- TODO: test
+NATIVE(DestroyMenu, _destroyMenu, r_int, p_int)
+// DestroyObject(objectid) -- TODO: test
+NATIVE(DestroyObject, _destroyObject, r_none, p_int)
+// DestroyPickup(pickupid) -- TODO: test
+NATIVE(DestroyPickup, _destroyPickup, r_none, p_int)
+// DestroyPlayerObject(playerid, objectid) -- TODO: test
+NATIVE(DestroyPlayerObject, _destroyPlayerObject, r_none, p_int, p_int)
+// DestroyVehicle(vehicleid) -- TODO: test
+NATIVE(DestroyVehicle, _destroyVehicle, r_none, p_int)
+// DetachTrailerFromVehicle(vehicleid) -- TODO: test
+NATIVE(DetachTrailerFromVehicle, _detachTrailerFromVehicle, r_none, p_int)
+// DisableInteriorEnterExits() -- TODO: test
+NATIVE(DisableInteriorEnterExits, _disableInteriorEnterExits, r_none)
+// DisableMenu(Menu:menuid) -- TODO: test
+NATIVE(DisableMenu, _disableMenu, r_none, p_int)
+// DisableMenuRow(Menu:menuid, row) -- TODO: test
+NATIVE(DisableMenuRow, _disableMenuRow, r_none, p_int, p_int)
+// DisableNameTagLOS() -- TODO: test
+NATIVE(DisableNameTagLOS, _disableNameTagLOS, r_none)
+// DisablePlayerCheckpoint(playerid) -- TODO: test
+NATIVE(DisablePlayerCheckpoint, _disablePlayerCheckpoint, r_none, p_int)
+// DisablePlayerRaceCheckpoint(playerid) -- TODO: test
+NATIVE(DisablePlayerRaceCheckpoint, _disablePlayerRaceCheckpoint, r_none, p_int)
+// EditObject(playerid, objectid) -- TODO: test
+NATIVE(EditObject, _editObject, r_none, p_int, p_int)
+// EditPlayerObject(playerid, objectid) -- TODO: test
+NATIVE(EditPlayerObject, _editPlayerObject, r_none, p_int, p_int)
+// EditAttachedObject(playerid, index) -- TODO: test
+NATIVE(EditAttachedObject, _editAttachedObject, r_none, p_int, p_int)
+// EnableStuntBonusForAll(enable) -- TODO: test
+NATIVE(EnableStuntBonusForAll, _enableStuntBonusForAll, r_none, p_int)
+// EnableStuntBonusForPlayer(playerid, enable) -- TODO: test
+NATIVE(EnableStuntBonusForPlayer, _enableStuntBonusForPlayer, r_none, p_int, p_int)
+// EnableVehicleFriendlyFire() -- TODO: test
+NATIVE(EnableVehicleFriendlyFire, _enableVehicleFriendlyFire, r_none)
+// ForceClassSelection(playerid) -- TODO: test
+NATIVE(ForceClassSelection, _forceClassSelection, r_none, p_int)
+// GameModeExit() -- TODO: test
+NATIVE(GameModeExit, _gameModeExit, r_none)
+// GameTextForAll(string[], time, style) -- TODO: test
+NATIVE(GameTextForAll, _gameTextForAll, r_none, p_string, p_int, p_int)
+// GameTextForPlayer(playerid, string[], time, style) -- TODO: test
+NATIVE(GameTextForPlayer, _gameTextForPlayer, r_none, p_int, p_string, p_int, p_int)
+// int GangZoneCreate(Float:minx, Float:miny, Float:maxx, Float:maxy) -- TODO: test
+NATIVE(GangZoneCreate, _gangZoneCreate, r_int, p_float, p_float, p_float, p_float)
+// GangZoneDestroy(zone) -- TODO: test
+NATIVE(GangZoneDestroy, _gangZoneDestroy, r_none, p_int)
+// GangZoneFlashForAll(zone, flashcolor) -- TODO: test
+NATIVE(GangZoneFlashForAll, _gangZoneFlashForAll, r_none, p_int, p_color)
+// GangZoneFlashForPlayer(playerid, zone, flashcolor) -- TODO: test
+NATIVE(GangZoneFlashForPlayer, _gangZoneFlashForPlayer, r_none, p_int, p_int, p_color)
+// GangZoneHideForAll(zone) -- TODO: test
+NATIVE(GangZoneHideForAll, _gangZoneHideForAll, r_none, p_int)
+// GangZoneHideForPlayer(playerid, zone) -- TODO: test
+NATIVE(GangZoneHideForPlayer, _gangZoneHideForPlayer, r_none, p_int, p_int)
+// int GangZoneShowForAll(zone, color) -- TODO: test
+NATIVE(GangZoneShowForAll, _gangZoneShowForAll, r_int, p_int, p_color)
+// GangZoneShowForPlayer(playerid, zone, color) -- TODO: test
+NATIVE(GangZoneShowForPlayer, _gangZoneShowForPlayer, r_none, p_int, p_int, p_color)
+// GangZoneStopFlashForAll(zone) -- TODO: test
+NATIVE(GangZoneStopFlashForAll, _gangZoneStopFlashForAll, r_none, p_int)
+// GangZoneStopFlashForPlayer(playerid, zone) -- TODO: test
+NATIVE(GangZoneStopFlashForPlayer, _gangZoneStopFlashForPlayer, r_none, p_int, p_int)
+// int GetMaxPlayers()
+NATIVE(GetMaxPlayers, _getMaxPlayers, r_int)
+// GetNetworkStats(retstr[], retstr_size)
+NATIVE(GetNetworkStats, _getNetworkStats, r_out, o_string<401>)
+// GetObjectPos(objectid, &Float:X, &Float:Y, &Float:Z) -- TODO: test
+NATIVE(GetObjectPos, _getObjectPos, r_vec3, p_int, o_float, o_float, o_float)
+// GetObjectRot(objectid, &Float:RotX, &Float:RotY, &Float:RotZ) -- TODO: test
+NATIVE(GetObjectRot, _getObjectRot, r_vec3, p_int, o_float, o_float, o_float)
+// int GetPVarFloat(playerid, varname[])
+NATIVE(GetPVarFloat, _getPVarFloat, r_float, p_int, p_string)
+// int GetPVarInt(playerid, varname[])
+NATIVE(GetPVarInt, _getPVarInt, r_int, p_int, p_string)
+// int GetPVarString(playerid, varname[], string_return[], len)
+NATIVE(GetPVarString, _getPVarString, r_out, p_int, p_string, o_string<2048>)
+// int GetPlayerAmmo(playerid) -- TODO: test
+NATIVE(GetPlayerAmmo, _getPlayerAmmo, r_int, p_int)
+// int GetPlayerAnimationIndex(playerid)
+NATIVE(GetPlayerAnimationIndex, _getPlayerAnimationIndex, r_int, p_int)
+// GetPlayerArmour(playerid, Float:&armour)
+NATIVE(GetPlayerArmour, _getPlayerArmour, r_out, p_int, o_float)
+// GetPlayerCameraFrontVector(playerid, &Float:x, &Float:y, &Float:z)
+NATIVE(GetPlayerCameraFrontVector, _getPlayerCameraFrontVector, r_vec3, p_int, o_float, o_float, o_float)
+// int GetPlayerCameraMode(playerid)
+NATIVE(GetPlayerCameraMode, _getPlayerCameraMode, r_int, p_int)
+// GetPlayerCameraPos(playerid, Float:&x, Float:&y, Float:&z)
+NATIVE(GetPlayerCameraPos, _getPlayerCameraPos, r_vec3, p_int, o_float, o_float, o_float)
+// int GetPlayerColor(playerid)
+NATIVE(GetPlayerColor, _getPlayerColor, r_int, p_int)
+// float GetPlayerDistanceFromPoint(playerid, Float:X, Float:Y, Float:Z)
+NATIVE(GetPlayerDistanceFromPoint, _getPlayerDistanceFromPoint, r_float, p_int, p_float, p_float, p_float)
+// int GetPlayerDrunkLevel(playerid)
+NATIVE(GetPlayerDrunkLevel, _getPlayerDrunkLevel, r_int, p_int)
+// GetPlayerFacingAngle(playerid,Float:&Angle)
+NATIVE(GetPlayerFacingAngle, _getPlayerFacingAngle, r_out, p_int, o_float)
+// int GetPlayerFightingStyle(playerid)
+NATIVE(GetPlayerFightingStyle, _getPlayerFightingStyle, r_int, p_int)
+// GetPlayerHealth(playerid, &health)
+NATIVE(GetPlayerHealth, _getPlayerHealth, r_out, p_int, o_float)
+// int GetPlayerInterior(playerid)
+NATIVE(GetPlayerInterior, _getPlayerInterior, r_int, p_int)
+// GetPlayerIp -- players.cpp, served from the identity cache
+// GetPlayerKeys(playerid, &keys, &updown, &leftright)
+NATIVE(GetPlayerKeys, _getPlayerKeys, r_keys, p_int, o_int, o_int, o_int)
+// int GetPlayerMenu(playerid) -- TODO: test
+NATIVE(GetPlayerMenu, _getPlayerMenu, r_int, p_int)
+// int GetPlayerMoney(playerid)
+NATIVE(GetPlayerMoney, _getPlayerMoney, r_int, p_int)
+// GetPlayerName -- players.cpp, served from the identity cache
+// GetPlayerNetworkStats(playerid, retstr[], retstr_size)
+NATIVE(GetPlayerNetworkStats, _getPlayerNetworkStats, r_out, p_int, o_string<401>)
+// GetPlayerObjectPos(playerid, objectid, &Float:X, &Float:Y, &Float:Z) -- TODO: test
+NATIVE(GetPlayerObjectPos, _getPlayerObjectPos, r_vec3, p_int, p_int, o_float, o_float, o_float)
+// GetPlayerObjectRot(playerid, objectid, &Float:RotX, &Float:RotY, &Float:RotZ) -- TODO: test
+NATIVE(GetPlayerObjectRot, _getPlayerObjectRot, r_vec3, p_int, p_int, o_float, o_float, o_float)
+// int GetPlayerPing(playerid)
+NATIVE(GetPlayerPing, _getPlayerPing, r_int, p_int)
+// GetPlayerPos(playerid, Float:&x, Float:&y, Float:&z)
+NATIVE(GetPlayerPos, _getPlayerPos, r_vec3, p_int, o_float, o_float, o_float)
+// int GetPlayerScore(playerid)
+NATIVE(GetPlayerScore, _getPlayerScore, r_int, p_int)
+// int GetPlayerSkin(playerid)
+NATIVE(GetPlayerSkin, _getPlayerSkin, r_int, p_int)
+// int GetPlayerSpecialAction(playerid)
+NATIVE(GetPlayerSpecialAction, _getPlayerSpecialAction, r_int, p_int)
+// int GetPlayerState(playerid)
+NATIVE(GetPlayerState, _getPlayerState, r_int, p_int)
+// int GetPlayerSurfingObjectID(playerid) -- TODO: test
+NATIVE(GetPlayerSurfingObjectID, _getPlayerSurfingObjectID, r_int, p_int)
+// int GetPlayerSurfingVehicleID(playerid) -- TODO: test
+NATIVE(GetPlayerSurfingVehicleID, _getPlayerSurfingVehicleID, r_int, p_int)
+// int GetPlayerTargetPlayer(playerid)
+NATIVE(GetPlayerTargetPlayer, _getPlayerTargetPlayer, r_int, p_int)
+// int GetPlayerTeam(playerid)
+NATIVE(GetPlayerTeam, _getPlayerTeam, r_int, p_int)
+// GetPlayerTime(playerid, &hour, &minute)
+NATIVE(GetPlayerTime, _getPlayerTime, r_time, p_int, o_int, o_int)
+// int GetPlayerVehicleID(playerid) -- TODO: test
+NATIVE(GetPlayerVehicleID, _getPlayerVehicleID, r_int, p_int)
+// int GetPlayerVehicleSeat(playerid) -- TODO: test
+NATIVE(GetPlayerVehicleSeat, _getPlayerVehicleSeat, r_int, p_int)
+// GetPlayerVelocity(playerid, &Float:x, &Float:y, &Float:z)
+NATIVE(GetPlayerVelocity, _getPlayerVelocity, r_vec3, p_int, o_float, o_float, o_float)
+// GetPlayerVersion -- players.cpp, served from the identity cache
+// int GetPlayerVirtualWorld(playerid)
+NATIVE(GetPlayerVirtualWorld, _getPlayerVirtualWorld, r_int, p_int)
+// int GetPlayerWantedLevel(playerid)
+NATIVE(GetPlayerWantedLevel, _getPlayerWantedLevel, r_int, p_int)
+// int GetPlayerWeapon(playerid)
+NATIVE(GetPlayerWeapon, _getPlayerWeapon, r_int, p_int)
+// GetPlayerWeaponData(playerid, slot, &weapons, &ammo)
+NATIVE(GetPlayerWeaponData, _getPlayerWeaponData, r_weapon, p_int, p_int, o_int, o_int)
+// int GetPlayerWeaponState(playerid)
+NATIVE(GetPlayerWeaponState, _getPlayerWeaponState, r_int, p_int)
+// int GetTickCount()
+NATIVE(GetTickCount, _getTickCount, r_int)
+// int GetVehicleComponentInSlot(vehicleid, slot) -- TODO: test
+NATIVE(GetVehicleComponentInSlot, _getVehicleComponentInSlot, r_int, p_int, p_int)
+// int GetVehicleComponentType(component) -- TODO: test
+NATIVE(GetVehicleComponentType, _getVehicleComponentType, r_int, p_int)
+// GetVehicleDamageStatus(vehicleid, &panels, &doors, &lights, &tires) -- TODO: test
+NATIVE(GetVehicleDamageStatus, _getVehicleDamageStatus, r_damage, p_int, o_int, o_int, o_int, o_int)
+// float GetVehicleDistanceFromPoint(vehicleid, Float:X, Float:Y, Float:Z) -- TODO: test
+NATIVE(GetVehicleDistanceFromPoint, _getVehicleDistanceFromPoint, r_float, p_int, p_float, p_float, p_float)
+// GetVehicleHealth(vehicleid, &Float:health) -- TODO: test
+NATIVE(GetVehicleHealth, _getVehicleHealth, r_out, p_int, o_float)
+// int GetVehicleModel(vehicleid) -- TODO: test
+NATIVE(GetVehicleModel, _getVehicleModel, r_int, p_int)
+// GetVehicleModelInfo(vehiclemodel, infotype, &Float:X, &Float:Y, &Float:Z) -- TODO: test
+NATIVE(GetVehicleModelInfo, _getVehicleModelInfo, r_vec3, p_int, p_int, o_float, o_float, o_float)
+// GetVehiclePos(vehicleid, &Float:X, &Float:Y, &Float:Z) -- TODO: test
+NATIVE(GetVehiclePos, _getVehiclePos, r_vec3, p_int, o_float, o_float, o_float)
+// int GetVehicleRotationQuat(vehicleid, &Float:w, &Float:x, &Float:y, &Float:z) -- TODO: test
+NATIVE(GetVehicleRotationQuat, _getVehicleRotationQuat, r_quat, p_int, o_float, o_float, o_float, o_float)
+// int GetVehicleTrailer(vehicleid) -- TODO: test
+NATIVE(GetVehicleTrailer, _getVehicleTrailer, r_int, p_int)
+// GetVehicleVelocity(vehicleid, &Float:x, &Float:y, &Float:z) -- TODO: test
+NATIVE(GetVehicleVelocity, _getVehicleVelocity, r_vec3, p_int, o_float, o_float, o_float)
+// int GetVehicleVirtualWorld(vehicleid) -- TODO: test
+NATIVE(GetVehicleVirtualWorld, _getVehicleVirtualWorld, r_int, p_int)
+// GetVehicleZAngle(vehicleid, &Float:z_angl) -- TODO: test
+NATIVE(GetVehicleZAngle, _getVehicleZAngle, r_out, p_int, o_float)
+// GetWeaponName(weaponid, const weapon[], len)
+NATIVE(GetWeaponName, _getWeaponName, r_out, p_int, o_string<32>)
+// GivePlayerMoney(playerid, money)
+NATIVE(GivePlayerMoney, _givePlayerMoney, r_none, p_int, p_int)
+// GivePlayerWeapon(playerid, weaponid, ammo)
+NATIVE(GivePlayerWeapon, _givePlayerWeapon, r_none, p_int, p_int, p_int)
+// HideMenuForPlayer(menuid, playerid) -- TODO: test
+NATIVE(HideMenuForPlayer, _hideMenuForPlayer, r_none, p_int, p_int)
+// InterpolateCameraPos(playerid, Float:FromX, Float:FromY, Float:FromZ, Float:ToX, Float:ToY, Float:ToZ, time, cut = CAMERA_CUT) -- TODO: test
+NATIVE(InterpolateCameraPos, _interpolateCameraPos, r_none, p_int, p_float, p_float, p_float, p_float, p_float, p_float, p_int, opt_int<CAMERA_CUT>)
+// InterpolateCameraLookAt(playerid, Float:FromX, Float:FromY, Float:FromZ, Float:ToX, Float:ToY, Float:ToZ, time, cut = CAMERA_CUT) -- TODO: test
+NATIVE(InterpolateCameraLookAt, _interpolateCameraLookAt, r_none, p_int, p_float, p_float, p_float, p_float, p_float, p_float, p_int, opt_int<CAMERA_CUT>)
+// int IsObjectMoving(objectid) -- TODO: test
+NATIVE(IsObjectMoving, _isObjectMoving, r_int, p_int)
+// int IsPlayerAdmin(playerid)
+NATIVE(IsPlayerAdmin, _isPlayerAdmin, r_int, p_int)
+// int IsPlayerAttachedObjectSlotUsed(playerid, index) -- TODO: test
+NATIVE(IsPlayerAttachedObjectSlotUsed, _isPlayerAttachedObjectSlotUsed, r_int, p_int, p_int)
+// IsPlayerConnected -- players.cpp, answered from the connected player set
+// int IsPlayerHoldingObject(playerid) -- TODO: test
+NATIVE(IsPlayerHoldingObject, _isPlayerHoldingObject, r_int, p_int)
+// int IsPlayerInAnyVehicle(playerid) -- TODO: test
+NATIVE(IsPlayerInAnyVehicle, _isPlayerInAnyVehicle, r_int, p_int)
+// int IsPlayerInCheckpoint(playerid) -- TODO: test
+NATIVE(IsPlayerInCheckpoint, _isPlayerInCheckpoint, r_int, p_int)
+// int IsPlayerInRaceCheckpoint(playerid) -- TODO: test
+NATIVE(IsPlayerInRaceCheckpoint, _isPlayerInRaceCheckpoint, r_int, p_int)
+// int IsPlayerInRangeOfPoint(playerid, Float:range, Float:x, Float:y, Float:z)
+NATIVE(IsPlayerInRangeOfPoint, _isPlayerInRangeOfPoint, r_int, p_int, p_float, p_float, p_float, p_float)
+// int IsPlayerInVehicle(playerid, vehicleid) -- TODO: test
+NATIVE(IsPlayerInVehicle, _isPlayerInVehicle, r_int, p_int, p_int)
+// IsPlayerNPC -- players.cpp, answered from the connected player set
+// int IsPlayerObjectMoving(objectid) -- TODO: test
+NATIVE(IsPlayerObjectMoving, _isPlayerObjectMoving, r_int, p_int)
+// int IsPlayerStreamedIn(playerid, forplayerid)
+NATIVE(IsPlayerStreamedIn, _isPlayerStreamedIn, r_int, p_int, p_int)
+// int IsTrailerAttachedToVehicle(vehicleid) -- TODO: test
+NATIVE(IsTrailerAttachedToVehicle, _isTrailerAttachedToVehicle, r_int, p_int)
+// int IsValidMenu(Menu:menuid) -- TODO: test
+NATIVE(IsValidMenu, _isValidMenu, r_int, p_int)
+// int IsValidObject(objectid) -- TODO: test
+NATIVE(IsValidObject, _isValidObject, r_int, p_int)
+// int IsValidPlayerObject(playerid, objectid) -- TODO: test
+NATIVE(IsValidPlayerObject, _isValidPlayerObject, r_int, p_int, p_int)
+// int IsVehicleStreamedIn(vehicleid, forplayerid) -- TODO: test
+NATIVE(IsVehicleStreamedIn, _isVehicleStreamedIn, r_int, p_int, p_int)
+// Kick(playerid)
+NATIVE(Kick, _kick, r_none, p_int)
+// LimitGlobalChatRadius(Float:chat_radius) -- TODO: test
+NATIVE(LimitGlobalChatRadius, _limitGlobalChatRadius, r_none, p_float)
+// LimitPlayerMarkerRadius(Float:marker_radius) -- TODO: test
+NATIVE(LimitPlayerMarkerRadius, _limitPlayerMarkerRadius, r_none, p_float)
+// LinkVehicleToInterior(vehicleid, interiorid) -- TODO: test
+NATIVE(LinkVehicleToInterior, _linkVehicleToInterior, r_none, p_int, p_int)
+// ManualVehicleEngineAndLights() -- TODO: test / 0.3c
+NATIVE(ManualVehicleEngineAndLights, _manualVehicleEngineAndLights, r_none)
+// int MoveObject(objectid, Float:X, Float:Y, Float:Z, Float:Speed, Float:RotX = -1000.0, Float:RotY = -1000.0, Float:RotZ = -1000.0) -- TODO: test
+NATIVE(MoveObject, _moveObject, r_int, p_int, p_float, p_float, p_float, p_float, opt_float<-1000>, opt_float<-1000>, opt_float<-1000>)
+// int MovePlayerObject(playerid, objectid, Float:X, Float:Y, Float:Z, Float:Speed, Float:RotX = -1000.0, Float:RotY = -1000.0, Float:RotZ = -1000.0) -- TODO: test
+NATIVE(MovePlayerObject, _movePlayerObject, r_int, p_int, p_int, p_float, p_float, p_float, p_float, opt_float<-1000>, opt_float<-1000>, opt_float<-1000>)
+// PlayAudioStreamForPlayer(playerid, url[], Float:posX = 0.0, Float:posY = 0.0, Float:posZ = 0.0, Float:distance = 50.0, usepos = 0) -- TODO: test
+NATIVE(PlayAudioStreamForPlayer, _playAudioStreamForPlayer, r_none, p_int, p_string, opt_float<0>, opt_float<0>, opt_float<0>, opt_float<50>, opt_int<0>)
+// PlayCrimeReportForPlayer(playerid, suspectid, crimeid)
+NATIVE(PlayCrimeReportForPlayer, _playCrimeReportForPlayer, r_none, p_int, p_int, p_int)
+// PlayerPlaySound(playerid, soundid, Float:x, Float:y, Float:z)
+NATIVE(PlayerPlaySound, _playerPlaySound, r_none, p_int, p_int, p_float, p_float, p_float)
+// PlayerSpectatePlayer(playerid, targetplayerid, mode = SPECTATE_MODE_NORMAL) -- TODO: test
+NATIVE(PlayerSpectatePlayer, _playerSpectatePlayer, r_none, p_int, p_int, opt_int<SPECTATE_MODE_NORMAL>)
+// PlayerSpectateVehicle(playerid, targetvehicleid, mode = SPECTATE_MODE_NORMAL) -- TODO: test
+NATIVE(PlayerSpectateVehicle, _playerSpectateVehicle, r_none, p_int, p_int, opt_int<SPECTATE_MODE_NORMAL>)
+// PutPlayerInVehicle(playerid,vehicleid,seatid) -- TODO: test
+NATIVE(PutPlayerInVehicle, _putPlayerInVehicle, r_none, p_int, p_int, p_int)
+// CreatePlayerTextDraw -- textdraws.cpp, records the text in the textdraw shadow
+// PlayerTextDrawDestroy -- textdraws.cpp, clears the textdraw shadow
+// PlayerTextDrawLetterSize(playerid, PlayerText:text, Float:x, Float:y)
+NATIVE(PlayerTextDrawLetterSize, _playerTextDrawLetterSize, r_none, p_int, p_player_textdraw, p_float, p_float)
+// PlayerTextDrawTextSize(playerid, PlayerText:text, Float:x, Float:y) -- TODO: test
+NATIVE(PlayerTextDrawTextSize, _playerTextDrawTextSize, r_none, p_int, p_player_textdraw, p_float, p_float)
+// PlayerTextDrawAlignment(playerid, PlayerText:text, alignment) -- TODO: test
+NATIVE(PlayerTextDrawAlignment, _playerTextDrawAlignment, r_none, p_int, p_player_textdraw, p_int)
+// PlayerTextDrawColor -- textdraws.cpp, dropped if unchanged
+// PlayerTextDrawUseBox -- textdraws.cpp, dropped if unchanged
+// PlayerTextDrawBoxColor -- textdraws.cpp, dropped if unchanged
+// PlayerTextDrawSetPreviewModel(playerid, PlayerText:text, modelindex) -- TODO: test
+NATIVE(PlayerTextDrawSetPreviewModel, _playerTextDrawSetPreviewModel, r_none, p_int, p_player_textdraw, p_int)
+// PlayerTextDrawSetPreviewRot(playerid, PlayerText:text, Float:fRotX, Float:fRotY, Float:fRotZ, Float:fZoom) -- TODO: test
+NATIVE(PlayerTextDrawSetPreviewRot, _playerTextDrawSetPreviewRot, r_none, p_int, p_player_textdraw, p_float, p_float, p_float, p_float)
+// PlayerTextDrawSetPreviewVehCol(PlayerText:text, playerid, color1, color2) -- TODO: test
+NATIVE(PlayerTextDrawSetPreviewVehCol, _playerTextDrawSetPreviewVehCol, r_none, p_int, p_player_textdraw, p_int, p_int)
+// PlayerTextDrawSetShadow(playerid, PlayerText:text, size) -- TODO: test
+NATIVE(PlayerTextDrawSetShadow, _playerTextDrawSetShadow, r_none, p_int, p_player_textdraw, p_int)
+// PlayerTextDrawSetOutline(playerid, PlayerText:text, size)
+NATIVE(PlayerTextDrawSetOutline, _playerTextDrawSetOutline, r_none, p_int, p_player_textdraw, p_int)
+// PlayerTextDrawBackgroundColor(playerid, PlayerText:text, color) -- TODO: test
+NATIVE(PlayerTextDrawBackgroundColor, _playerTextDrawBackgroundColor, r_none, p_int, p_player_textdraw, p_color)
+// PlayerTextDrawFont(playerid, PlayerText:text, font) -- TODO: test
+NATIVE(PlayerTextDrawFont, _playerTextDrawFont, r_none, p_int, p_player_textdraw, p_int)
+// PlayerTextDrawSetProportional(playerid, PlayerText:text, set) -- TODO: test
+NATIVE(PlayerTextDrawSetProportional, _playerTextDrawSetProportional, r_none, p_int, p_player_textdraw, p_int)
+// PlayerTextDrawSetSelectable(playerid, PlayerText:text, set)
+NATIVE(PlayerTextDrawSetSelectable, _playerTextDrawSetSelectable, r_none, p_int, p_player_textdraw, p_int)
+// PlayerTextDrawShow -- textdraws.cpp, dropped if already shown
+// PlayerTextDrawHide -- textdraws.cpp, dropped if already hidden
+// PlayerTextDrawSetString -- textdraws.cpp, dropped if unchanged
+// RemoveBuildingForPlayer(playerid, modelid, Float:fX, Float:fY, Float:fZ, Float:fRadius)
+NATIVE(RemoveBuildingForPlayer, _removeBuildingForPlayer, r_none, p_int, p_int, p_float, p_float, p_float, p_float)
+// int RemovePlayerAttachedObject(playerid,index) -- TODO: test
+NATIVE(RemovePlayerAttachedObject, _removePlayerAttachedObject, r_int, p_int, p_int)
+// RemovePlayerFromVehicle(playerid) -- TODO: test
+NATIVE(RemovePlayerFromVehicle, _removePlayerFromVehicle, r_none, p_int)
+// RemovePlayerMapIcon(playerid, iconid) -- TODO: test
+NATIVE(RemovePlayerMapIcon, _removePlayerMapIcon, r_none, p_int, p_int)
+// RemoveVehicleComponent(vehicleid, componentid) -- TODO: test
+NATIVE(RemoveVehicleComponent, _removeVehicleComponent, r_none, p_int, p_int)
+// RepairVehicle(vehicleid) -- TODO: test
+NATIVE(RepairVehicle, _repairVehicle, r_none, p_int)
+// ResetPlayerMoney(playerid)
+NATIVE(ResetPlayerMoney, _resetPlayerMoney, r_none, p_int)
+// ResetPlayerWeapons(playerid)
+NATIVE(ResetPlayerWeapons, _resetPlayerWeapons, r_none, p_int)
+// SelectObject(playerid)
+NATIVE(SelectObject, _selectObject, r_none, p_int)
+// SelectTextDraw(playerid, hovercolor)
+NATIVE(SelectTextDraw, _selectTextDraw, r_none, p_int, p_color)
+// void SendClientMessage(playerid, color, const message[])
+NATIVE(SendClientMessage, _sendClientMessage, r_none, p_int, p_color, p_string)
+// SendClientMessageToAll(color, const message[])
+NATIVE(SendClientMessageToAll, _sendClientMessageToAll, r_none, p_color, p_string)
+// SendDeathMessage(killer, victim, reason)
+NATIVE(SendDeathMessage, _sendDeathMessage, r_none, p_int, p_int, p_int)
+// SendPlayerMessageToAll(senderid, const message[])
+NATIVE(SendPlayerMessageToAll, _sendPlayerMessageToAll, r_none, p_int, p_string)
+// SendPlayerMessageToPlayer(playerid, senderid, const message[])
+NATIVE(SendPlayerMessageToPlayer, _sendPlayerMessageToPlayer, r_none, p_int, p_int, p_string)
+// SendRconCommand(command[])
+NATIVE(SendRconCommand, _sendRconCommand, r_none, p_string)
+// SetCameraBehindPlayer(playerid)
+NATIVE(SetCameraBehindPlayer, _setCameraBehindPlayer, r_none, p_int)
+// SetGravity(Float:gravity)
+NATIVE(SetGravity, _setGravity, r_none, p_float)
+// SetMenuColumnHeader(menuid, column, text[]) -- TODO: test
+NATIVE(SetMenuColumnHeader, _setMenuColumnHeader, r_none, p_int, p_int, p_string)
+// SetNameTagDrawDistance(Float:distance) -- TODO: test
+NATIVE(SetNameTagDrawDistance, _setNameTagDrawDistance, r_none, p_float)
+// SetObjectPos(objectid, Float:X, Float:Y, Float:Z) -- TODO: test
+NATIVE(SetObjectPos, _setObjectPos, r_none, p_int, p_float, p_float, p_float)
+// SetObjectRot(objectid, Float:RotX, Float:RotY, Float:RotZ) -- TODO: test
+NATIVE(SetObjectRot, _setObjectRot, r_none, p_int, p_float, p_float, p_float)
+// SetPVarFloat(playerid, varname[], Float:float_value)
+NATIVE(SetPVarFloat, _setPVarFloat, r_int, p_int, p_string, p_float)
+// SetPVarInt(playerid, varname[], value)
+NATIVE(SetPVarInt, _setPVarInt, r_int, p_int, p_string, p_int)
+// SetPVarString(playerid, varname[], string_value[])
+NATIVE(SetPVarString, _setPVarString, r_none, p_int, p_string, p_string)
+// SetPlayerAmmo(playerid, weapon, ammo)
+NATIVE(SetPlayerAmmo, _setPlayerAmmo, r_none, p_int, p_int, p_int)
+// SetPlayerArmedWeapon(playerid, weaponid)
+NATIVE(SetPlayerArmedWeapon, _setPlayerArmedWeapon, r_none, p_int, p_int)
+// SetPlayerArmour(playerid, Float:armour)
+NATIVE(SetPlayerArmour, _setPlayerArmour, r_none, p_int, p_float)
+// int SetPlayerAttachedObject(playerid, index, modelid, bone, Float:fOffsetX, Float:fOffsetY, Float:fOffsetZ, Float:fRotX, Float:fRotY, Float:fRotZ, Float:fScaleX, Float:fScaleY, Float:fScaleZ, materialcolor1 = 0, materialcolor2 = 0) -- TODO: test / 0.3c
+NATIVE(SetPlayerAttachedObject, _setPlayerAttachedObject, r_int, p_int, p_int, p_int, p_int, p_float, p_float, p_float, p_float, p_float, p_float, p_float, p_float, p_float, p_int, p_int)
+// SetPlayerCameraLookAt(playerid,Float:x,Float:y,Float:z,cut=CAMERA_CUT)
+NATIVE(SetPlayerCameraLookAt, _setPlayerCameraLookAt, r_none, p_int, p_float, p_float, p_float, opt_int<CAMERA_CUT>)
+// SetPlayerCameraPos(playerid,Float:x,Float:y,Float:z)
+NATIVE(SetPlayerCameraPos, _setPlayerCameraPos, r_none, p_int, p_float, p_float, p_float)
+// SetPlayerChatBubble(playerid, text[], color, Float:drawdistance, expiretime)
+NATIVE(SetPlayerChatBubble, _setPlayerChatBubble, r_none, p_int, p_string, p_color, p_float, p_int)
+// SetPlayerCheckpoint(playerid,Float:x,Float:y,Float:z,Float:size)
+NATIVE(SetPlayerCheckpoint, _setPlayerCheckpoint, r_none, p_int, p_float, p_float, p_float, p_float)
+// SetPlayerColor(playerid,color)
+NATIVE(SetPlayerColor, _setPlayerColor, r_none, p_int, p_color)
+// SetPlayerDrunkLevel(playerid, level)
+NATIVE(SetPlayerDrunkLevel, _setPlayerDrunkLevel, r_none, p_int, p_int)
+// SetPlayerFacingAngle(playerid,Float:ang)
+NATIVE(SetPlayerFacingAngle, _setPlayerFacingAngle, r_none, p_int, p_float)
+// SetPlayerFightingStyle(playerid, style)
+NATIVE(SetPlayerFightingStyle, _setPlayerFightingStyle, r_none, p_int, p_int)
+// SetPlayerHealth(playerid, Float:health)
+NATIVE(SetPlayerHealth, _setPlayerHealth, r_none, p_int, p_float)
+// SetPlayerInterior(playerid,interiorid)
+NATIVE(SetPlayerInterior, _setPlayerInterior, r_none, p_int, p_int)
+// int SetPlayerMapIcon(playerid, iconid, Float:x, Float:y, Float:z, markertype, color, style)
+NATIVE(SetPlayerMapIcon, _setPlayerMapIcon, r_none, p_int, p_int, p_float, p_float, p_float, p_int, p_color, p_int)
+// SetPlayerMarkerForPlayer(playerid, showplayerid, color)
+NATIVE(SetPlayerMarkerForPlayer, _setPlayerMarkerForPlayer, r_none, p_int, p_int, p_color)
+// SetPlayerName -- players.cpp, updates the identity cache
+// SetPlayerObjectPos(playerid, objectid, Float:X, Float:Y, Float:Z) -- TODO: test
+NATIVE(SetPlayerObjectPos, _setPlayerObjectPos, r_none, p_int, p_int, p_float, p_float, p_float)
+// SetPlayerObjectRot(playerid, objectid, Float:RotX, Float:RotY, Float:RotZ) -- TODO: test
+NATIVE(SetPlayerObjectRot, _setPlayerObjectRot, r_none, p_int, p_int, p_float, p_float, p_float)
+// SetPlayerPos(playerid,Float:x,Float:y,Float:z)
+NATIVE(SetPlayerPos, _setPlayerPos, r_none, p_int, p_float, p_float, p_float)
+// SetPlayerPosFindZ(playerid, Float:x, Float:y, Float:z)
+NATIVE(SetPlayerPosFindZ, _setPlayerPosFindZ, r_none, p_int, p_float, p_float, p_float)
+// SetPlayerRaceCheckpoint(playerid, type, Float:x, Float:y, Float:z, Float:nextx, Float:nexty, Float:nextz, Float:size)
+NATIVE(SetPlayerRaceCheckpoint, _setPlayerRaceCheckpoint, r_none, p_int, p_int, p_float, p_float, p_float, p_float, p_float, p_float, p_float)
+// SetPlayerScore(playerid, score)
+NATIVE(SetPlayerScore, _setPlayerScore, r_none, p_int, p_int)
+// SetPlayerShopName(playerid, shopname[])
+NATIVE(SetPlayerShopName, _setPlayerShopName, r_none, p_int, p_string)
+// SetPlayerSkillLevel(playerid, skill, level)
+NATIVE(SetPlayerSkillLevel, _setPlayerSkillLevel, r_none, p_int, p_int, p_int)
+// SetPlayerSkin(playerid, skinid)
+NATIVE(SetPlayerSkin, _setPlayerSkin, r_none, p_int, p_int)
+// SetPlayerSpecialAction(playerid, actionid)
+NATIVE(SetPlayerSpecialAction, _setPlayerSpecialAction, r_none, p_int, p_int)
+// SetPlayerTeam(playerid, teamid) -- TODO: test
+NATIVE(SetPlayerTeam, _setPlayerTeam, r_none, p_int, p_int)
+// SetPlayerTime(playerid, hour, minute)
+NATIVE(SetPlayerTime, _setPlayerTime, r_none, p_int, p_int, p_int)
+// SetPlayerVelocity(playerid, Float:x, Float:y, Float:z)
+NATIVE(SetPlayerVelocity, _setPlayerVelocity, r_none, p_int, p_float, p_float, p_float)
+// SetPlayerVirtualWorld(playerid,worldid)
+NATIVE(SetPlayerVirtualWorld, _setPlayerVirtualWorld, r_none, p_int, p_int)
+// SetPlayerWantedLevel(playerid, level)
+NATIVE(SetPlayerWantedLevel, _setPlayerWantedLevel, r_none, p_int, p_int)
+// SetPlayerWeather(playerid, weather)
+NATIVE(SetPlayerWeather, _setPlayerWeather, r_none, p_int, p_int)
+// SetPlayerWorldBounds(playerid,Float:x_max,Float:x_min,Float:y_max,Float:y_min)
+NATIVE(SetPlayerWorldBounds, _setPlayerWorldBounds, r_none, p_int, p_float, p_float, p_float, p_float)
+// SetSpawnInfo(playerid, team, skin, Float:x, Float:y, Float:z, Float:Angle, weapon1, weapon1_ammo, weapon2, weapon2_ammo, weapon3, weapon3_ammo) -- TODO: test
+NATIVE(SetSpawnInfo, _setSpawnInfo, r_none, p_int, p_int, p_int, p_float, p_float, p_float, p_float, p_int, p_int, p_int, p_int, p_int, p_int)
+// SetTeamCount(teams) -- TODO: test
+NATIVE(SetTeamCount, _setTeamCount, r_none, p_int)
+// SetVehicleAngularVelocity(vehicleid, Float:x, Float:y, Float:z)
+NATIVE(SetVehicleAngularVelocity, _setVehicleAngularVelocity, r_none, p_int, p_float, p_float, p_float)
+// SetVehicleHealth(vehicleid, Float:health)
+NATIVE(SetVehicleHealth, _setVehicleHealth, r_none, p_int, p_float)
+// SetVehicleNumberPlate(vehicleid, numberplate[])
+NATIVE(SetVehicleNumberPlate, _setVehicleNumberPlate, r_none, p_int, p_string)
+// SetVehicleParamsEx(vehicleid, engine, lights, alarm, doors, bonnet, boot, objective) -- 0.3c
+NATIVE(SetVehicleParamsEx, _setVehicleParamsEx, r_none, p_int, p_int, p_int, p_int, p_int, p_int, p_int, p_int)
+// SetVehicleParamsForPlayer(vehicleid,playerid,objective,doorslocked)
+NATIVE(SetVehicleParamsForPlayer, _setVehicleParamsForPlayer, r_none, p_int, p_int, p_int, p_int)
+// SetVehiclePos(vehicleid, Float:x, Float:y, Float:z)
+NATIVE(SetVehiclePos, _setVehiclePos, r_none, p_int, p_float, p_float, p_float)
+// SetVehicleToRespawn(vehicleid)
+NATIVE(SetVehicleToRespawn, _setVehicleToRespawn, r_none, p_int)
+// SetVehicleVelocity(vehicleid, Float:x, Float:y, Float:z)
+NATIVE(SetVehicleVelocity, _setVehicleVelocity, r_none, p_int, p_float, p_float, p_float)
+// SetVehicleVirtualWorld(vehicleid,worldid)
+NATIVE(SetVehicleVirtualWorld, _setVehicleVirtualWorld, r_none, p_int, p_int)
+// SetVehicleZAngle(vehicleid, Float:z_angl)
+NATIVE(SetVehicleZAngle, _setVehicleZAngle, r_none, p_int, p_float)
+// SetWeather(weatherid)
+NATIVE(SetWeather, _setWeather, r_none, p_int)
+// SetWorldTime(hour)
+NATIVE(SetWorldTime, _setWorldTime, r_none, p_int)
+// ShowMenuForPlayer(menuid, playerid) -- TODO: test
+NATIVE(ShowMenuForPlayer, _showMenuForPlayer, r_none, p_int, p_int)
+// ShowNameTags(enabled) -- TODO: test
+NATIVE(ShowNameTags, _showNameTags, r_none, p_int)
+// ShowPlayerDialog(playerid, dialogid, style, caption[], info[], button1[], button2[])
+NATIVE(ShowPlayerDialog, _showPlayerDialog, r_none, p_int, p_int, p_int, p_string, p_string, p_string, p_string)
+// ShowPlayerMarkers(mode) -- TODO: test
+NATIVE(ShowPlayerMarkers, _showPlayerMarkers, r_none, p_int)
+// ShowPlayerNameTagForPlayer(playerid, showplayerid, show) -- TODO: test
+NATIVE(ShowPlayerNameTagForPlayer, _showPlayerNameTagForPlayer, r_none, p_int, p_int, p_int)
+// SpawnPlayer(playerid)
+NATIVE(SpawnPlayer, _spawnPlayer, r_none, p_int)
+// StartRecordingPlayerData(playerid, recordtype, recordname[]) -- TODO: test
+NATIVE(StartRecordingPlayerData, _startRecordingPlayerData, r_none, p_int, p_int, p_string)
+// StopAudioStreamForPlayer(playerid)
+NATIVE(StopAudioStreamForPlayer, _stopAudioStreamForPlayer, r_none, p_int)
+// StopObject(objectid) -- TODO: test
+NATIVE(StopObject, _stopObject, r_none, p_int)
+// StopPlayerObject(playerid, objectid) -- TODO: test
+NATIVE(StopPlayerObject, _stopPlayerObject, r_none, p_int, p_int)
+// StopRecordingPlayerData(playerid) -- TODO: test
+NATIVE(StopRecordingPlayerData, _stopRecordingPlayerData, r_none, p_int)
+// TextDrawAlignment(Text:text, alignment) -- TODO: test
+NATIVE(TextDrawAlignment, _textDrawAlignment, r_none, p_textdraw, p_int)
+// TextDrawBackgroundColor(Text:text, color) -- TODO: test
+NATIVE(TextDrawBackgroundColor, _textDrawBackgroundColor, r_none, p_textdraw, p_color)
+// TextDrawBoxColor -- textdraws.cpp, dropped if unchanged
+// TextDrawColor -- textdraws.cpp, dropped if unchanged
+// TextDrawCreate -- textdraws.cpp, records the text in the textdraw shadow
+// TextDrawDestroy -- textdraws.cpp, clears the textdraw shadow
+// TextDrawFont(Text:text, font) -- TODO: test
+NATIVE(TextDrawFont, _textDrawFont, r_none, p_textdraw, p_int)
+// TextDrawHideForAll -- textdraws.cpp, dropped if already hidden from everyone
+// TextDrawHideForPlayer -- textdraws.cpp, dropped if already hidden
+// TextDrawLetterSize(Text:text, Float:x, Float:y) -- TODO: test
+NATIVE(TextDrawLetterSize, _textDrawLetterSize, r_none, p_textdraw, p_float, p_float)
+// TextDrawSetOutline(Text:text, size) -- TODO: test
+NATIVE(TextDrawSetOutline, _textDrawSetOutline, r_none, p_textdraw, p_int)
+// TextDrawSetPreviewModel(Text:text, modelindex) -- TODO: test
+NATIVE(TextDrawSetPreviewModel, _textDrawSetPreviewModel, r_none, p_textdraw, p_int)
+// TextDrawSetPreviewRot(Text:text, Float:fRotX, Float:fRotY, Float:fRotZ, Float:fZoom) -- TODO: test
+NATIVE(TextDrawSetPreviewRot, _textDrawSetPreviewRot, r_none, p_textdraw, p_float, p_float, p_float, p_float)
+// TextDrawSetPreviewVehCol(Text:text, color1, color2) -- TODO: test
+NATIVE(TextDrawSetPreviewVehCol, _textDrawSetPreviewVehCol, r_none, p_textdraw, p_int, p_int)
+// TextDrawSetProportional(Text:text, set) -- TODO: test
+NATIVE(TextDrawSetProportional, _textDrawSetProportional, r_none, p_textdraw, p_int)
+// TextDrawSetSelectable(Text:text, set)
+NATIVE(TextDrawSetSelectable, _textDrawSetSelectable, r_none, p_textdraw, p_int)
+// TextDrawSetShadow(Text:text, size) -- TODO: test
+NATIVE(TextDrawSetShadow, _textDrawSetShadow, r_none, p_textdraw, p_int)
+// TextDrawSetString -- textdraws.cpp, dropped if unchanged
+// TextDrawShowForAll -- textdraws.cpp, dropped if already shown to everyone
+// TextDrawShowForPlayer -- textdraws.cpp, dropped if already shown
+// TextDrawTextSize(Text:text, Float:x, Float:y) -- TODO: test
+NATIVE(TextDrawTextSize, _textDrawTextSize, r_none, p_textdraw, p_float, p_float)
+// TextDrawUseBox -- textdraws.cpp, dropped if unchanged
+// TogglePlayerClock(playerid, toggle)
+NATIVE(TogglePlayerClock, _togglePlayerClock, r_none, p_int, p_int)
+// TogglePlayerControllable(playerid, toggle)
+NATIVE(TogglePlayerControllable, _togglePlayerControllable, r_none, p_int, p_int)
+// TogglePlayerSpectating(playerid, toggle)
+NATIVE(TogglePlayerSpectating, _togglePlayerSpectating, r_none, p_int, p_int)
+// Update3DTextLabelText(Text3D:id, color, text[]) -- TODO: test
+NATIVE(Update3DTextLabelText, _update3DTextLabelText, r_none, p_int, p_color, p_string)
+// UpdatePlayer3DTextLabelText(playerid, PlayerText3D:id, color, text[]) -- TODO: test
+NATIVE(UpdatePlayer3DTextLabelText, _updatePlayer3DTextLabelText, r_none, p_int, p_int, p_color, p_string)
+// UpdateVehicleDamageStatus(vehicleid, panels, doors, lights, tires)
+NATIVE(UpdateVehicleDamageStatus, _updateVehicleDamageStatus, r_none, p_int, p_int, p_int, p_int, p_int)
+// UsePlayerPedAnims() -- TODO: test
+NATIVE(UsePlayerPedAnims, _usePlayerPedAnims, r_none)
@@ -0,0 +1,350 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// every native the wrappers call, as NATIVE_SLOT(name, slot); the includer defines
+// NATIVE_SLOT to declare or define the slots. No include guard on purpose.
+
+NATIVE_SLOT(AddMenuItem, _addMenuItem)
+NATIVE_SLOT(AddPlayerClass, _addPlayerClass)
+NATIVE_SLOT(AddPlayerClassEx, _addPlayerClassEx)
+NATIVE_SLOT(AddStaticPickup, _addStaticPickup)
+NATIVE_SLOT(AddStaticVehicle, _addStaticVehicle)
+NATIVE_SLOT(AddStaticVehicleEx, _addStaticVehicleEx)
+NATIVE_SLOT(AddVehicleComponent, _addVehicleComponent)
+NATIVE_SLOT(AllowAdminTeleport, _allowAdminTeleport)
+NATIVE_SLOT(AllowInteriorWeapons, _allowInteriorWeapons)
+NATIVE_SLOT(AllowPlayerTeleport, _allowPlayerTeleport)
+NATIVE_SLOT(ApplyAnimation, _applyAnimation)
+NATIVE_SLOT(Attach3DTextLabelToPlayer, _attach3DTextLabelToPlayer)
+NATIVE_SLOT(Attach3DTextLabelToVehicle, _attach3DTextLabelToVehicle)
+NATIVE_SLOT(AttachCameraToObject, _attachCameraToObject)
+NATIVE_SLOT(AttachCameraToPlayerObject, _attachCameraToPlayerObject)
+NATIVE_SLOT(AttachObjectToObject, _attachObjectToObject)
+NATIVE_SLOT(AttachObjectToPlayer, _attachObjectToPlayer)
+NATIVE_SLOT(AttachObjectToVehicle, _attachObjectToVehicle)
+NATIVE_SLOT(AttachPlayerObjectToPlayer, _attachPlayerObjectToPlayer)
+NATIVE_SLOT(AttachPlayerObjectToVehicle, _attachPlayerObjectToVehicle)
+NATIVE_SLOT(AttachTrailerToVehicle, _attachTrailerToVehicle)
+
+NATIVE_SLOT(Ban, _ban)
+NATIVE_SLOT(BanEx, _banEx)
+
+NATIVE_SLOT(CallRemoteFunction, _callRemoteFunction)
+
+NATIVE_SLOT(CancelEdit, _cancelEdit)
+NATIVE_SLOT(CancelSelectTextDraw, _cancelSelectTextDraw)
+NATIVE_SLOT(ChangeVehicleColor, _changeVehicleColor)
+NATIVE_SLOT(ChangeVehiclePaintjob, _changeVehiclePaintjob)
+NATIVE_SLOT(ClearAnimations, _clearAnimations)
+NATIVE_SLOT(ConnectNPC, _connectNPC)
+NATIVE_SLOT(Create3DTextLabel, _create3DTextLabel)
+NATIVE_SLOT(CreateExplosion, _createExplosion)
+NATIVE_SLOT(CreateMenu, _createMenu)
+NATIVE_SLOT(CreateObject, _createObject)
+NATIVE_SLOT(CreatePickup, _createPickup)
+NATIVE_SLOT(CreatePlayer3DTextLabel, _createPlayer3DTextLabel)
+NATIVE_SLOT(CreatePlayerObject, _createPlayerObject)
+NATIVE_SLOT(CreateVehicle, _createVehicle)
+
+NATIVE_SLOT(Delete3DTextLabel, _delete3DTextLabel)
+NATIVE_SLOT(DeletePVar, _deletePVar)
+NATIVE_SLOT(DeletePlayer3DTextLabel, _deletePlayer3DTextLabel)
+NATIVE_SLOT(DestroyMenu, _destroyMenu)
+NATIVE_SLOT(DestroyObject, _destroyObject)
+NATIVE_SLOT(DestroyPickup, _destroyPickup)
+NATIVE_SLOT(DestroyPlayerObject, _destroyPlayerObject)
+NATIVE_SLOT(DestroyVehicle, _destroyVehicle)
+NATIVE_SLOT(DetachTrailerFromVehicle, _detachTrailerFromVehicle)
+NATIVE_SLOT(DisableInteriorEnterExits, _disableInteriorEnterExits)
+NATIVE_SLOT(DisableMenu, _disableMenu)
+NATIVE_SLOT(DisableMenuRow, _disableMenuRow)
+NATIVE_SLOT(DisableNameTagLOS, _disableNameTagLOS)
+NATIVE_SLOT(DisablePlayerCheckpoint, _disablePlayerCheckpoint)
+NATIVE_SLOT(DisablePlayerRaceCheckpoint, _disablePlayerRaceCheckpoint)
+
+NATIVE_SLOT(EditObject, _editObject)
+NATIVE_SLOT(EditPlayerObject, _editPlayerObject)
+NATIVE_SLOT(EditAttachedObject, _editAttachedObject)
+NATIVE_SLOT(EnableStuntBonusForAll, _enableStuntBonusForAll)
+NATIVE_SLOT(EnableStuntBonusForPlayer, _enableStuntBonusForPlayer)
+NATIVE_SLOT(EnableVehicleFriendlyFire, _enableVehicleFriendlyFire)
+NATIVE_SLOT(ForceClassSelection, _forceClassSelection)
+
+NATIVE_SLOT(GameModeExit, _gameModeExit)
+NATIVE_SLOT(GameTextForAll, _gameTextForAll)
+NATIVE_SLOT(GameTextForPlayer, _gameTextForPlayer)
+NATIVE_SLOT(GangZoneCreate, _gangZoneCreate)
+NATIVE_SLOT(GangZoneDestroy, _gangZoneDestroy)
+NATIVE_SLOT(GangZoneFlashForAll, _gangZoneFlashForAll)
+NATIVE_SLOT(GangZoneFlashForPlayer, _gangZoneFlashForPlayer)
+NATIVE_SLOT(GangZoneHideForAll, _gangZoneHideForAll)
+NATIVE_SLOT(GangZoneHideForPlayer, _gangZoneHideForPlayer)
+NATIVE_SLOT(GangZoneShowForAll, _gangZoneShowForAll)
+NATIVE_SLOT(GangZoneShowForPlayer, _gangZoneShowForPlayer)
+NATIVE_SLOT(GangZoneStopFlashForAll, _gangZoneStopFlashForAll)
+NATIVE_SLOT(GangZoneStopFlashForPlayer, _gangZoneStopFlashForPlayer)
+NATIVE_SLOT(GetAnimationName, _getAnimationName)
+NATIVE_SLOT(GetMaxPlayers, _getMaxPlayers)
+NATIVE_SLOT(GetNetworkStats, _getNetworkStats)
+NATIVE_SLOT(GetObjectPos, _getObjectPos)
+NATIVE_SLOT(GetObjectRot, _getObjectRot)
+NATIVE_SLOT(GetPVarFloat, _getPVarFloat)
+NATIVE_SLOT(GetPVarInt, _getPVarInt)
+NATIVE_SLOT(GetPVarString, _getPVarString)
+NATIVE_SLOT(GetPlayerAmmo, _getPlayerAmmo)
+NATIVE_SLOT(GetPlayerAnimationIndex, _getPlayerAnimationIndex)
+NATIVE_SLOT(GetPlayerArmour, _getPlayerArmour)
+NATIVE_SLOT(GetPlayerCameraFrontVector, _getPlayerCameraFrontVector)
+NATIVE_SLOT(GetPlayerCameraMode, _getPlayerCameraMode)
+NATIVE_SLOT(GetPlayerCameraPos, _getPlayerCameraPos)
+NATIVE_SLOT(GetPlayerColor, _getPlayerColor)
+NATIVE_SLOT(GetPlayerDistanceFromPoint, _getPlayerDistanceFromPoint)
+NATIVE_SLOT(GetPlayerDrunkLevel, _getPlayerDrunkLevel)
+NATIVE_SLOT(GetPlayerFacingAngle, _getPlayerFacingAngle)
+NATIVE_SLOT(GetPlayerFightingStyle, _getPlayerFightingStyle)
+NATIVE_SLOT(GetPlayerHealth, _getPlayerHealth)
+NATIVE_SLOT(GetPlayerInterior, _getPlayerInterior)
+NATIVE_SLOT(GetPlayerIp, _getPlayerIp)
+NATIVE_SLOT(GetPlayerKeys, _getPlayerKeys)
+NATIVE_SLOT(GetPlayerMenu, _getPlayerMenu)
+NATIVE_SLOT(GetPlayerMoney, _getPlayerMoney)
+NATIVE_SLOT(GetPlayerName, _getPlayerName)
+NATIVE_SLOT(GetPlayerNetworkStats, _getPlayerNetworkStats)
+NATIVE_SLOT(GetPlayerObjectPos, _getPlayerObjectPos)
+NATIVE_SLOT(GetPlayerObjectRot, _getPlayerObjectRot)
+NATIVE_SLOT(GetPlayerPing, _getPlayerPing)
+NATIVE_SLOT(GetPlayerPos, _getPlayerPos)
+NATIVE_SLOT(GetPlayerScore, _getPlayerScore)
+NATIVE_SLOT(GetPlayerSkin, _getPlayerSkin)
+NATIVE_SLOT(GetPlayerSpecialAction, _getPlayerSpecialAction)
+NATIVE_SLOT(GetPlayerState, _getPlayerState)
+NATIVE_SLOT(GetPlayerSurfingObjectID, _getPlayerSurfingObjectID)
+NATIVE_SLOT(GetPlayerSurfingVehicleID, _getPlayerSurfingVehicleID)
+NATIVE_SLOT(GetPlayerTargetPlayer, _getPlayerTargetPlayer)
+NATIVE_SLOT(GetPlayerTeam, _getPlayerTeam)
+NATIVE_SLOT(GetPlayerTime, _getPlayerTime)
+NATIVE_SLOT(GetPlayerVehicleID, _getPlayerVehicleID)
+NATIVE_SLOT(GetPlayerVehicleSeat, _getPlayerVehicleSeat)
+NATIVE_SLOT(GetPlayerVelocity, _getPlayerVelocity)
+NATIVE_SLOT(GetPlayerVersion, _getPlayerVersion)
+NATIVE_SLOT(GetPlayerVirtualWorld, _getPlayerVirtualWorld)
+NATIVE_SLOT(GetPlayerWantedLevel, _getPlayerWantedLevel)
+NATIVE_SLOT(GetPlayerWeapon, _getPlayerWeapon)
+NATIVE_SLOT(GetPlayerWeaponData, _getPlayerWeaponData)
+NATIVE_SLOT(GetPlayerWeaponState, _getPlayerWeaponState)
+NATIVE_SLOT(GetTickCount, _getTickCount)
+NATIVE_SLOT(GetVehicleComponentInSlot, _getVehicleComponentInSlot)
+NATIVE_SLOT(GetVehicleComponentType, _getVehicleComponentType)
+NATIVE_SLOT(GetVehicleDamageStatus, _getVehicleDamageStatus)
+NATIVE_SLOT(GetVehicleDistanceFromPoint, _getVehicleDistanceFromPoint)
+NATIVE_SLOT(GetVehicleHealth, _getVehicleHealth)
+NATIVE_SLOT(GetVehicleModel, _getVehicleModel)
+NATIVE_SLOT(GetVehicleModelInfo, _getVehicleModelInfo)
+NATIVE_SLOT(GetVehiclePos, _getVehiclePos)
+NATIVE_SLOT(GetVehicleRotationQuat, _getVehicleRotationQuat)
+NATIVE_SLOT(GetVehicleTrailer, _getVehicleTrailer)
+NATIVE_SLOT(GetVehicleVelocity, _getVehicleVelocity)
+NATIVE_SLOT(GetVehicleVirtualWorld, _getVehicleVirtualWorld)
+NATIVE_SLOT(GetVehicleZAngle, _getVehicleZAngle)
+NATIVE_SLOT(GetWeaponName, _getWeaponName)
+NATIVE_SLOT(GivePlayerMoney, _givePlayerMoney)
+NATIVE_SLOT(GivePlayerWeapon, _givePlayerWeapon)
+
+NATIVE_SLOT(HideMenuForPlayer, _hideMenuForPlayer)
+
+NATIVE_SLOT(InterpolateCameraPos, _interpolateCameraPos)
+NATIVE_SLOT(InterpolateCameraLookAt, _interpolateCameraLookAt)
+NATIVE_SLOT(IsObjectMoving, _isObjectMoving)
+NATIVE_SLOT(IsPlayerAdmin, _isPlayerAdmin)
+NATIVE_SLOT(IsPlayerAttachedObjectSlotUsed, _isPlayerAttachedObjectSlotUsed)
+NATIVE_SLOT(IsPlayerConnected, _isPlayerConnected)
+NATIVE_SLOT(IsPlayerHoldingObject, _isPlayerHoldingObject)
+NATIVE_SLOT(IsPlayerInAnyVehicle, _isPlayerInAnyVehicle)
+NATIVE_SLOT(IsPlayerInCheckpoint, _isPlayerInCheckpoint)
+NATIVE_SLOT(IsPlayerInRaceCheckpoint, _isPlayerInRaceCheckpoint)
+NATIVE_SLOT(IsPlayerInRangeOfPoint, _isPlayerInRangeOfPoint)
+NATIVE_SLOT(IsPlayerInVehicle, _isPlayerInVehicle)
+NATIVE_SLOT(IsPlayerNPC, _isPlayerNPC)
+NATIVE_SLOT(IsPlayerObjectMoving, _isPlayerObjectMoving)
+NATIVE_SLOT(IsPlayerStreamedIn, _isPlayerStreamedIn)
+NATIVE_SLOT(IsTrailerAttachedToVehicle, _isTrailerAttachedToVehicle)
+NATIVE_SLOT(IsValidMenu, _isValidMenu)
+NATIVE_SLOT(IsValidObject, _isValidObject)
+NATIVE_SLOT(IsValidPlayerObject, _isValidPlayerObject)
+NATIVE_SLOT(IsVehicleStreamedIn, _isVehicleStreamedIn)
+
+NATIVE_SLOT(Kick, _kick)
+NATIVE_SLOT(KillTimer, _killTimer)
+
+NATIVE_SLOT(LimitGlobalChatRadius, _limitGlobalChatRadius)
+NATIVE_SLOT(LimitPlayerMarkerRadius, _limitPlayerMarkerRadius)
+NATIVE_SLOT(LinkVehicleToInterior, _linkVehicleToInterior)
+
+NATIVE_SLOT(ManualVehicleEngineAndLights, _manualVehicleEngineAndLights)
+NATIVE_SLOT(MoveObject, _moveObject)
+NATIVE_SLOT(MovePlayerObject, _movePlayerObject)
+
+NATIVE_SLOT(PlayAudioStreamForPlayer, _playAudioStreamForPlayer)
+NATIVE_SLOT(PlayCrimeReportForPlayer, _playCrimeReportForPlayer)
+NATIVE_SLOT(PlayerPlaySound, _playerPlaySound)
+NATIVE_SLOT(PlayerSpectatePlayer, _playerSpectatePlayer)
+NATIVE_SLOT(PlayerSpectateVehicle, _playerSpectateVehicle)
+NATIVE_SLOT(PutPlayerInVehicle, _putPlayerInVehicle)
+
+NATIVE_SLOT(CreatePlayerTextDraw, _createPlayerTextDraw)
+NATIVE_SLOT(PlayerTextDrawDestroy, _playerTextDrawDestroy)
+NATIVE_SLOT(PlayerTextDrawLetterSize, _playerTextDrawLetterSize)
+NATIVE_SLOT(PlayerTextDrawTextSize, _playerTextDrawTextSize)
+NATIVE_SLOT(PlayerTextDrawAlignment, _playerTextDrawAlignment)
+NATIVE_SLOT(PlayerTextDrawColor, _playerTextDrawColor)
+NATIVE_SLOT(PlayerTextDrawUseBox, _playerTextDrawUseBox)
+NATIVE_SLOT(PlayerTextDrawBoxColor, _playerTextDrawBoxColor)
+NATIVE_SLOT(PlayerTextDrawSetShadow, _playerTextDrawSetShadow)
+NATIVE_SLOT(PlayerTextDrawSetOutline, _playerTextDrawSetOutline)
+NATIVE_SLOT(PlayerTextDrawBackgroundColor, _playerTextDrawBackgroundColor)
+NATIVE_SLOT(PlayerTextDrawFont, _playerTextDrawFont)
+NATIVE_SLOT(PlayerTextDrawSetPreviewModel, _playerTextDrawSetPreviewModel)
+NATIVE_SLOT(PlayerTextDrawSetPreviewRot, _playerTextDrawSetPreviewRot)
+NATIVE_SLOT(PlayerTextDrawSetPreviewVehCol, _playerTextDrawSetPreviewVehCol)
+NATIVE_SLOT(PlayerTextDrawSetProportional, _playerTextDrawSetProportional)
+NATIVE_SLOT(PlayerTextDrawSetSelectable, _playerTextDrawSetSelectable)
+NATIVE_SLOT(PlayerTextDrawShow, _playerTextDrawShow)
+NATIVE_SLOT(PlayerTextDrawHide, _playerTextDrawHide)
+NATIVE_SLOT(PlayerTextDrawSetString, _playerTextDrawSetString)
+
+NATIVE_SLOT(RemoveBuildingForPlayer, _removeBuildingForPlayer)
+NATIVE_SLOT(RemovePlayerAttachedObject, _removePlayerAttachedObject)
+NATIVE_SLOT(RemovePlayerFromVehicle, _removePlayerFromVehicle)
+NATIVE_SLOT(RemovePlayerMapIcon, _removePlayerMapIcon)
+NATIVE_SLOT(RemoveVehicleComponent, _removeVehicleComponent)
+NATIVE_SLOT(RepairVehicle, _repairVehicle)
+NATIVE_SLOT(ResetPlayerMoney, _resetPlayerMoney)
+NATIVE_SLOT(ResetPlayerWeapons, _resetPlayerWeapons)
+
+NATIVE_SLOT(SelectObject, _selectObject)
+NATIVE_SLOT(SelectTextDraw, _selectTextDraw)
+NATIVE_SLOT(SendClientMessage, _sendClientMessage)
+NATIVE_SLOT(SendClientMessageToAll, _sendClientMessageToAll)
+NATIVE_SLOT(SendDeathMessage, _sendDeathMessage)
+NATIVE_SLOT(SendPlayerMessageToAll, _sendPlayerMessageToAll)
+NATIVE_SLOT(SendPlayerMessageToPlayer, _sendPlayerMessageToPlayer)
+NATIVE_SLOT(SendRconCommand, _sendRconCommand)
+NATIVE_SLOT(SetCameraBehindPlayer, _setCameraBehindPlayer)
+NATIVE_SLOT(SetGameModeText, _setGameModeText)
+NATIVE_SLOT(SetGravity, _setGravity)
+NATIVE_SLOT(SetMenuColumnHeader, _setMenuColumnHeader)
+NATIVE_SLOT(SetNameTagDrawDistance, _setNameTagDrawDistance)
+NATIVE_SLOT(SetObjectMaterial, _setObjectMaterial)
+NATIVE_SLOT(SetObjectMaterialText, _setObjectMaterialText)
+NATIVE_SLOT(SetObjectPos, _setObjectPos)
+NATIVE_SLOT(SetObjectRot, _setObjectRot)
+NATIVE_SLOT(SetPVarFloat, _setPVarFloat)
+NATIVE_SLOT(SetPVarInt, _setPVarInt)
+NATIVE_SLOT(SetPVarString, _setPVarString)
+NATIVE_SLOT(SetPlayerAmmo, _setPlayerAmmo)
+NATIVE_SLOT(SetPlayerArmedWeapon, _setPlayerArmedWeapon)
+NATIVE_SLOT(SetPlayerArmour, _setPlayerArmour)
+NATIVE_SLOT(SetPlayerAttachedObject, _setPlayerAttachedObject)
+NATIVE_SLOT(SetPlayerCameraLookAt, _setPlayerCameraLookAt)
+NATIVE_SLOT(SetPlayerCameraPos, _setPlayerCameraPos)
+NATIVE_SLOT(SetPlayerChatBubble, _setPlayerChatBubble)
+NATIVE_SLOT(SetPlayerCheckpoint, _setPlayerCheckpoint)
+NATIVE_SLOT(SetPlayerColor, _setPlayerColor)
+NATIVE_SLOT(SetPlayerDrunkLevel, _setPlayerDrunkLevel)
+NATIVE_SLOT(SetPlayerFacingAngle, _setPlayerFacingAngle)
+NATIVE_SLOT(SetPlayerFightingStyle, _setPlayerFightingStyle)
+NATIVE_SLOT(SetPlayerHealth, _setPlayerHealth)
+NATIVE_SLOT(SetPlayerInterior, _setPlayerInterior)
+NATIVE_SLOT(SetPlayerMapIcon, _setPlayerMapIcon)
+NATIVE_SLOT(SetPlayerMarkerForPlayer, _setPlayerMarkerForPlayer)
+NATIVE_SLOT(SetPlayerName, _setPlayerName)
+NATIVE_SLOT(SetPlayerObjectMaterial, _setPlayerObjectMaterial)
+NATIVE_SLOT(SetPlayerObjectMaterialText, _setPlayerObjectMaterialText)
+NATIVE_SLOT(SetPlayerObjectPos, _setPlayerObjectPos)
+NATIVE_SLOT(SetPlayerObjectRot, _setPlayerObjectRot)
+NATIVE_SLOT(SetPlayerPos, _setPlayerPos)
+NATIVE_SLOT(SetPlayerPosFindZ, _setPlayerPosFindZ)
+NATIVE_SLOT(SetPlayerRaceCheckpoint, _setPlayerRaceCheckpoint)
+NATIVE_SLOT(SetPlayerScore, _setPlayerScore)
+NATIVE_SLOT(SetPlayerShopName, _setPlayerShopName)
+NATIVE_SLOT(SetPlayerSkillLevel, _setPlayerSkillLevel)
+NATIVE_SLOT(SetPlayerSkin, _setPlayerSkin)
+NATIVE_SLOT(SetPlayerSpecialAction, _setPlayerSpecialAction)
+NATIVE_SLOT(SetPlayerTeam, _setPlayerTeam)
+NATIVE_SLOT(SetPlayerTime, _setPlayerTime)
+NATIVE_SLOT(SetPlayerVelocity, _setPlayerVelocity)
+NATIVE_SLOT(SetPlayerVirtualWorld, _setPlayerVirtualWorld)
+NATIVE_SLOT(SetPlayerWantedLevel, _setPlayerWantedLevel)
+NATIVE_SLOT(SetPlayerWeather, _setPlayerWeather)
+NATIVE_SLOT(SetPlayerWorldBounds, _setPlayerWorldBounds)
+NATIVE_SLOT(SetSpawnInfo, _setSpawnInfo)
+NATIVE_SLOT(SetTeamCount, _setTeamCount)
+NATIVE_SLOT(SetTimerEx, _setTimerEx)
+NATIVE_SLOT(SetVehicleAngularVelocity, _setVehicleAngularVelocity)
+NATIVE_SLOT(SetVehicleHealth, _setVehicleHealth)
+NATIVE_SLOT(SetVehicleNumberPlate, _setVehicleNumberPlate)
+NATIVE_SLOT(SetVehicleParamsEx, _setVehicleParamsEx)
+NATIVE_SLOT(SetVehicleParamsForPlayer, _setVehicleParamsForPlayer)
+NATIVE_SLOT(SetVehiclePos, _setVehiclePos)
+NATIVE_SLOT(SetVehicleToRespawn, _setVehicleToRespawn)
+NATIVE_SLOT(SetVehicleVelocity, _setVehicleVelocity)
+NATIVE_SLOT(SetVehicleVirtualWorld, _setVehicleVirtualWorld)
+NATIVE_SLOT(SetVehicleZAngle, _setVehicleZAngle)
+NATIVE_SLOT(SetWeather, _setWeather)
+NATIVE_SLOT(SetWorldTime, _setWorldTime)
+NATIVE_SLOT(ShowMenuForPlayer, _showMenuForPlayer)
+NATIVE_SLOT(ShowNameTags, _showNameTags)
+NATIVE_SLOT(ShowPlayerDialog, _showPlayerDialog)
+NATIVE_SLOT(ShowPlayerMarkers, _showPlayerMarkers)
+NATIVE_SLOT(ShowPlayerNameTagForPlayer, _showPlayerNameTagForPlayer)
+NATIVE_SLOT(SpawnPlayer, _spawnPlayer)
+NATIVE_SLOT(StartRecordingPlayerData, _startRecordingPlayerData)
+NATIVE_SLOT(StopAudioStreamForPlayer, _stopAudioStreamForPlayer)
+NATIVE_SLOT(StopObject, _stopObject)
+NATIVE_SLOT(StopPlayerObject, _stopPlayerObject)
+NATIVE_SLOT(StopRecordingPlayerData, _stopRecordingPlayerData)
+
+NATIVE_SLOT(TextDrawAlignment, _textDrawAlignment)
+NATIVE_SLOT(TextDrawBackgroundColor, _textDrawBackgroundColor)
+NATIVE_SLOT(TextDrawBoxColor, _textDrawBoxColor)
+NATIVE_SLOT(TextDrawColor, _textDrawColor)
+NATIVE_SLOT(TextDrawCreate, _textDrawCreate)
+NATIVE_SLOT(TextDrawDestroy, _textDrawDestroy)
+NATIVE_SLOT(TextDrawFont, _textDrawFont)
+NATIVE_SLOT(TextDrawHideForAll, _textDrawHideForAll)
+NATIVE_SLOT(TextDrawHideForPlayer, _textDrawHideForPlayer)
+NATIVE_SLOT(TextDrawLetterSize, _textDrawLetterSize)
+NATIVE_SLOT(TextDrawSetOutline, _textDrawSetOutline)
+NATIVE_SLOT(TextDrawSetPreviewModel, _textDrawSetPreviewModel)
+NATIVE_SLOT(TextDrawSetPreviewRot, _textDrawSetPreviewRot)
+NATIVE_SLOT(TextDrawSetPreviewVehCol, _textDrawSetPreviewVehCol)
+NATIVE_SLOT(TextDrawSetProportional, _textDrawSetProportional)
+NATIVE_SLOT(TextDrawSetSelectable, _textDrawSetSelectable)
+NATIVE_SLOT(TextDrawSetShadow, _textDrawSetShadow)
+NATIVE_SLOT(TextDrawSetString, _textDrawSetString)
+NATIVE_SLOT(TextDrawShowForAll, _textDrawShowForAll)
+NATIVE_SLOT(TextDrawShowForPlayer, _textDrawShowForPlayer)
+NATIVE_SLOT(TextDrawTextSize, _textDrawTextSize)
+NATIVE_SLOT(TextDrawUseBox, _textDrawUseBox)
+NATIVE_SLOT(TogglePlayerClock, _togglePlayerClock)
+NATIVE_SLOT(TogglePlayerControllable, _togglePlayerControllable)
+NATIVE_SLOT(TogglePlayerSpectating, _togglePlayerSpectating)
+
+NATIVE_SLOT(Update3DTextLabelText, _update3DTextLabelText)
+NATIVE_SLOT(UpdatePlayer3DTextLabelText, _updatePlayer3DTextLabelText)
+NATIVE_SLOT(UpdateVehicleDamageStatus, _updateVehicleDamageStatus)
+NATIVE_SLOT(UsePlayerPedAnims, _usePlayerPedAnims)
@@ -0,0 +1,376 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "pythonplugin.h"
+#include <structmember.h>
+#include "nativefunctions.h"
+#include "pysamp.h"
+#include "scratch.h"
+#include "cp1252.h"
+#include "constants.h"
+#include "playerdata.h"
+
+struct player_column_data
+{
+	char name[MAX_COLUMN_NAME * 4 + 1];	// UTF-8
+	char kind;							// 'i', 'f' or 's'
+	bool pvar;
+	cell values[MAX_PLAYERS];			// ints, or the bits of floats
+	char *strings[MAX_PLAYERS];			// UTF-8, malloc'd; NULL for ''
+};
+
+// never freed, views of the values may outlive every column object
+static player_column_data *m_columns[MAX_PLAYER_COLUMNS];
+static int m_columnCount = 0;
+// only needed for the strings, ints and floats are read and written as a whole
+static Mutex m_columnsLock;
+
+struct player_column
+{
+	PyObject_HEAD
+	PyObject *name;
+	player_column_data *data;
+};
+
+static PyObject *_columnKindName(char kind)
+{
+	return (PyObject *)(kind == 'i' ? &PyLong_Type : (kind == 'f' ? &PyFloat_Type : &PyUnicode_Type));
+}
+
+// playerid of a subscript, -1 with IndexError set for ids out of range
+static long _columnRow(PyObject *key)
+{
+	long playerid = PyLong_AsLong(key);
+	if (playerid == -1 && PyErr_Occurred())
+		return -1;
+	if (playerid < 0 || playerid >= MAX_PLAYERS)
+	{
+		PyErr_Format(PyExc_IndexError, "playerid %ld out of range", playerid);
+		return -1;
+	}
+	return playerid;
+}
+
+static PyObject *_columnGet(PyObject *o, PyObject *key)
+{
+	player_column_data *data = ((player_column *)o)->data;
+	long playerid = _columnRow(key);
+	if (playerid == -1)
+		return NULL;
+
+	switch (data->kind)
+	{
+		case 'i':
+			return PyLong_FromLong(data->values[playerid]);
+		case 'f':
+			return PyFloat_FromDouble(amx_ctof(data->values[playerid]));
+	}
+
+	m_columnsLock.Lock();
+	const char *str = data->strings[playerid];
+	PyObject *ret = PyUnicode_FromString(str != NULL ? str : "");
+	m_columnsLock.Unlock();
+	return ret;
+}
+
+// sets the PVar of a column to value, already converted to v, or deletes it for NULL
+static bool _columnSetPVar(player_column *self, cell playerid, PyObject *value, cell v)
+{
+	cell params[4] = { 3 * sizeof(cell), playerid, 0, v };
+	scratch_mark mark = _scratchMark();
+
+	Py_ssize_t size = _cp1252Size(self->name);
+	cell *addr = size == -1 ? NULL : _scratchAllot((int)size, &params[2]);
+	bool ok = addr != NULL && _cp1252ToCells(self->name, addr, size);
+	if (ok && value != NULL && self->data->kind == 's')
+	{
+		size = _cp1252Size(value);
+		addr = size == -1 ? NULL : _scratchAllot((int)size, &params[3]);
+		ok = addr != NULL && _cp1252ToCells(value, addr, size);
+	}
+
+	if (ok)
+	{
+		if (value == NULL)
+		{
+			params[0] = 2 * sizeof(cell);
+			_deletePVar(m_AMX, params);
+		}
+		else if (self->data->kind == 'i')
+			_setPVarInt(m_AMX, params);
+		else if (self->data->kind == 'f')
+			_setPVarFloat(m_AMX, params);
+		else
+			_setPVarString(m_AMX, params);
+	}
+	_scratchRelease(mark);
+	return ok;
+}
+
+// column[playerid] = value; del column[playerid] resets it to 0, 0.0 or '' and
+// deletes the PVar
+static int _columnSet(PyObject *o, PyObject *key, PyObject *value)
+{
+	player_column *self = (player_column *)o;
+	player_column_data *data = self->data;
+	long playerid = _columnRow(key);
+	if (playerid == -1)
+		return -1;
+
+	cell v = 0;
+	const char *str = NULL;
+	Py_ssize_t len = 0;
+	if (value != NULL)
+	{
+		if (data->kind == 'i')
+		{
+			long l = PyLong_AsLong(value);
+			if (l == -1 && PyErr_Occurred())
+				return -1;
+			v = (cell)l;
+			if (v != l)
+			{
+				PyErr_SetString(PyExc_OverflowError, "int columns hold 32-bit values");
+				return -1;
+			}
+		}
+		else if (data->kind == 'f')
+		{
+			float f = (float)PyFloat_AsDouble(value);
+			if (f == -1.0f && PyErr_Occurred())
+				return -1;
+			v = amx_ftoc(f);
+		}
+		else
+		{
+			if (!PyUnicode_Check(value))
+			{
+				PyErr_Format(PyExc_TypeError, "%U is a str column, not %.200s", self->name, Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			str = PyUnicode_AsUTF8AndSize(value, &len);
+			if (str == NULL)
+				return -1;
+		}
+	}
+
+	if (data->pvar && !_columnSetPVar(self, playerid, value, v))
+		return -1;
+
+	if (data->kind != 's')
+	{
+		data->values[playerid] = v;
+		return 0;
+	}
+
+	char *copy = NULL;
+	if (len > 0)
+	{
+		copy = (char *)malloc(len + 1);
+		if (copy == NULL)
+		{
+			PyErr_NoMemory();
+			return -1;
+		}
+		memcpy(copy, str, len + 1);
+	}
+	m_columnsLock.Lock();
+	char *old = data->strings[playerid];
+	data->strings[playerid] = copy;
+	m_columnsLock.Unlock();
+	free(old);
+	return 0;
+}
+
+static Py_ssize_t _columnLength(PyObject *o)
+{
+	return MAX_PLAYERS;
+}
+
+// view()
+// read-only memoryview of the whole int or float column, indexed by playerid and
+// updated in place
+static PyObject *_columnView(PyObject *o, PyObject *args)
+{
+	player_column *self = (player_column *)o;
+	if (self->data->kind == 's')
+	{
+		PyErr_Format(PyExc_TypeError, "%U is a str column, only int and float columns have views", self->name);
+		return NULL;
+	}
+	return _pyNewView(self->data->values, MAX_PLAYERS, self->data->kind == 'i' ? "i" : "f", sizeof(cell));
+}
+
+static PyObject *_columnRepr(PyObject *o)
+{
+	player_column *self = (player_column *)o;
+	return PyUnicode_FromFormat("<samp.PlayerColumn %R of %s%s>", self->name,
+		((PyTypeObject *)_columnKindName(self->data->kind))->tp_name, self->data->pvar ? ", PVar" : "");
+}
+
+static void _columnDealloc(PyObject *o)
+{
+	player_column *self = (player_column *)o;
+	PyTypeObject *type = Py_TYPE(o);
+	Py_XDECREF(self->name);
+	type->tp_free(o);
+	Py_DECREF(type);
+}
+
+static PyMethodDef _columnMethods[] =
+{
+	{ "view", _columnView, METH_NOARGS, "Returns a read-only memoryview of an int or float column, indexed by playerid" },
+	{ NULL }
+};
+
+static PyMemberDef _columnMembers[] =
+{
+	{ "name", T_OBJECT, offsetof(player_column, name), READONLY, "Name of the column, and of its PVar" },
+	{ NULL }
+};
+
+static PyType_Slot _columnSlots[] =
+{
+	{ Py_mp_subscript, (void *)_columnGet },
+	{ Py_mp_ass_subscript, (void *)_columnSet },
+	{ Py_mp_length, (void *)_columnLength },
+	{ Py_tp_repr, (void *)_columnRepr },
+	{ Py_tp_dealloc, (void *)_columnDealloc },
+	{ Py_tp_methods, _columnMethods },
+	{ Py_tp_members, _columnMembers },
+	{ Py_tp_doc, (void *)"One int, float or str per player, see samp.player_column" },
+	{ 0, NULL }
+};
+
+static PyType_Spec _columnSpec =
+{
+	"samp.PlayerColumn",
+	sizeof(player_column),
+	0,
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_DISALLOW_INSTANTIATION,
+	_columnSlots
+};
+
+PyTypeObject *_playerColumnNewType(PyObject *module)
+{
+	return (PyTypeObject *)PyType_FromModuleAndSpec(module, &_columnSpec, NULL);
+}
+
+// called after the OnPlayerDisconnect callbacks
+void _playerDataDisconnect(cell playerid)
+{
+	if (playerid < 0 || playerid >= MAX_PLAYERS)
+		return;
+
+	m_columnsLock.Lock();
+	for (int i = 0; i < m_columnCount; i++)
+	{
+		m_columns[i]->values[playerid] = 0;
+		free(m_columns[i]->strings[playerid]);
+		m_columns[i]->strings[playerid] = NULL;
+	}
+	m_columnsLock.Unlock();
+}
+
+// the column of that name, created on its first declaration; NULL with an exception set
+static player_column_data *_columnData(PyObject *name, char kind, bool pvar)
+{
+	Py_ssize_t len;
+	const char *utf8 = PyUnicode_AsUTF8AndSize(name, &len);
+	if (utf8 == NULL)
+		return NULL;
+	if (PyUnicode_GET_LENGTH(name) == 0 || PyUnicode_GET_LENGTH(name) > MAX_COLUMN_NAME)
+	{
+		PyErr_Format(PyExc_ValueError, "column names have 1 to %d characters", MAX_COLUMN_NAME);
+		return NULL;
+	}
+
+	player_column_data *data = NULL;
+	m_columnsLock.Lock();
+	for (int i = 0; i < m_columnCount; i++)
+	{
+		if (strcmp(m_columns[i]->name, utf8) == 0)
+		{
+			data = m_columns[i];
+			break;
+		}
+	}
+	if (data != NULL)
+	{
+		if (data->kind != kind)
+		{
+			PyErr_Format(PyExc_ValueError, "column %R was declared with type %s", name,
+				((PyTypeObject *)_columnKindName(data->kind))->tp_name);
+			data = NULL;
+		}
+		else if (pvar)
+			data->pvar = true;
+	}
+	else if (m_columnCount == MAX_PLAYER_COLUMNS)
+		PyErr_Format(PyExc_ValueError, "at most %d player columns are supported", MAX_PLAYER_COLUMNS);
+	else
+	{
+		data = (player_column_data *)calloc(1, sizeof(player_column_data));
+		if (data == NULL)
+			PyErr_NoMemory();
+		else
+		{
+			memcpy(data->name, utf8, len + 1);
+			data->kind = kind;
+			data->pvar = pvar;
+			m_columns[m_columnCount++] = data;
+		}
+	}
+	m_columnsLock.Unlock();
+	return data;
+}
+
+// player_column(name, type, pvar = False)
+// type is int, float or str
+PyObject *sPlayerColumn(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	PyObject *name, *type;
+	int pvar = 0;
+	_pyParseFast(args, nargs, "O!O|p", &PyUnicode_Type, &name, &type, &pvar);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	char kind;
+	if (type == (PyObject *)&PyLong_Type)
+		kind = 'i';
+	else if (type == (PyObject *)&PyFloat_Type)
+		kind = 'f';
+	else if (type == (PyObject *)&PyUnicode_Type)
+		kind = 's';
+	else
+	{
+		PyErr_SetString(PyExc_TypeError, "player_column() takes int, float or str as type");
+		return NULL;
+	}
+
+	player_column_data *data = _columnData(name, kind, pvar != 0);
+	if (data == NULL)
+		return NULL;
+
+	player_column *column = PyObject_New(player_column, _pyPlayerColumnType(self));
+	if (column == NULL)
+		return NULL;
+	column->name = name;
+	Py_INCREF(name);
+	column->data = data;
+	return (PyObject *)column;
+}
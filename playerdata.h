@@ -0,0 +1,37 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __playerdata_h_
+#define __playerdata_h_
+
+// samp.player_column(name, type, pvar = False) returns a column of the per-player
+// store: one int, float or str per playerid in a dense array, read and written as
+// column[playerid] without going through the AMX. int and float columns can also be
+// read as a whole with column.view().
+// With pvar every write also sets the PVar of the same name, so Pawn scripts still
+// see the values; PVars set from Pawn don't come back into the column.
+// Columns are shared by all scripts and interpreters, declaring a name again returns
+// the same data. A player's row is reset to 0, 0.0 or '' when the player disconnects.
+
+#define MAX_PLAYER_COLUMNS	64
+#define MAX_COLUMN_NAME		40	// like PVar names
+
+PyTypeObject *_playerColumnNewType(PyObject *module);
+void _playerDataDisconnect(cell playerid);
+
+PyObject *sPlayerColumn(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+
+#endif
@@ -0,0 +1,732 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "pythonplugin.h"
+#include "nativefunctions.h"
+#include "pysamp.h"
+#include "scratch.h"
+#include "cp1252.h"
+#include "nativecall.h"
+#include "players.h"
+
+//-----------------------------------------
+// connected players
+//-----------------------------------------
+
+// sorted ids of all connected players, plus PLAYER_HUMAN / PLAYER_NPC per id;
+// changed by the server thread, the lock is for Python worker threads reading it
+static cell m_players[MAX_PLAYERS];
+static int m_playerCount = 0;
+static char m_playerType[MAX_PLAYERS];
+static Mutex m_playersLock;
+
+static bool _validPlayer(long playerid)
+{
+	return playerid >= 0 && playerid < MAX_PLAYERS;
+}
+
+//-----------------------------------------
+// identity cache
+//-----------------------------------------
+
+#define IDENTITY_NAME		0
+#define IDENTITY_IP			1
+#define IDENTITY_VERSION	2
+#define IDENTITY_FIELDS		3
+#define IDENTITY_LEN		32	// cells read from the natives, more than any of them returns
+
+// cp1252 string as read from the native, plus the str built from it. Str objects can't be
+// shared between interpreters, so only the main interpreter keeps them; they are interned
+// and handed out with just an incref. changes counts updates of value, obj is stale once
+// it no longer matches obj_changes.
+struct identity_field
+{
+	char value[IDENTITY_LEN];
+	unsigned int changes;
+	PyObject *obj;
+	unsigned int obj_changes;
+};
+
+static identity_field m_identity[MAX_PLAYERS][IDENTITY_FIELDS];
+
+static amx_function_t *const _identityNatives[IDENTITY_FIELDS] = { &_getPlayerName, &_getPlayerIp, &_getPlayerVersion };
+
+// reads the field from the native; runs without the GIL
+static void _identityRead(cell playerid, int field)
+{
+	cell params[4] = { 3 * sizeof(cell), playerid, 0, IDENTITY_LEN }, *addr;
+	char value[IDENTITY_LEN] = "";
+	if (amx_Allot(m_AMX, IDENTITY_LEN, &params[2], &addr) == AMX_ERR_NONE)
+	{
+		*addr = 0;
+		(*_identityNatives[field])(m_AMX, params);
+		amx_GetString(value, addr, 0, IDENTITY_LEN);
+		amx_Release(m_AMX, params[2]);
+	}
+
+	m_playersLock.Lock();
+	identity_field &f = m_identity[playerid][field];
+	memcpy(f.value, value, IDENTITY_LEN);
+	f.changes++;
+	m_playersLock.Unlock();
+}
+
+static PyObject *_identityGet(cell playerid, int field)
+{
+	if (!_validPlayer(playerid) || m_playerType[playerid] == PLAYER_NONE)
+		return PyUnicode_FromString("");
+
+	identity_field &f = m_identity[playerid][field];
+	bool main = _pyIsMainInterp();
+	char value[IDENTITY_LEN];
+	PyObject *stale = NULL, *ret;
+
+	m_playersLock.Lock();
+	if (main && f.obj != NULL && f.obj_changes == f.changes)
+	{
+		ret = f.obj;
+		Py_INCREF(ret);
+		m_playersLock.Unlock();
+		return ret;
+	}
+	unsigned int changes = f.changes;
+	memcpy(value, f.value, IDENTITY_LEN);
+	if (main && f.obj != NULL)
+	{
+		stale = f.obj;
+		f.obj = NULL;
+	}
+	m_playersLock.Unlock();
+
+	// no Python calls while holding the lock
+	Py_XDECREF(stale);
+	ret = _cp1252FromChars(value, IDENTITY_LEN, true);
+	if (ret == NULL || !main)
+		return ret;
+
+	PyUnicode_InternInPlace(&ret);
+	m_playersLock.Lock();
+	if (f.obj == NULL && f.changes == changes)
+	{
+		f.obj = ret;
+		f.obj_changes = changes;
+		Py_INCREF(ret);
+	}
+	m_playersLock.Unlock();
+	return ret;
+}
+
+// drops the cached str objects; called before Python is finalized
+void _playersClearCache()
+{
+	for (int i = 0; i < MAX_PLAYERS; i++)
+	{
+		for (int field = 0; field < IDENTITY_FIELDS; field++)
+			Py_CLEAR(m_identity[i][field].obj);
+	}
+}
+
+static PyObject *_identityWrapper(PyObject *const *args, Py_ssize_t nargs, int field)
+{
+	long playerid;
+	_pyParseFast(args, nargs, "l", &playerid);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	return _identityGet(playerid, field);
+}
+
+// GetPlayerName(playerid)
+PyObject *sGetPlayerName(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _identityWrapper(args, nargs, IDENTITY_NAME);
+}
+// GetPlayerIp(playerid)
+PyObject *sGetPlayerIp(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _identityWrapper(args, nargs, IDENTITY_IP);
+}
+// GetPlayerVersion(playerid)
+PyObject *sGetPlayerVersion(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _identityWrapper(args, nargs, IDENTITY_VERSION);
+}
+
+// SetPlayerName(playerid, name)
+// the cache only sees name changes made through Python; Pawn scripts calling
+// SetPlayerName directly leave the old name in it until the player reconnects
+PyObject *sSetPlayerName(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	long playerid;
+	char *name;
+	_pyParseFast(args, nargs, "lO&", &playerid, _stringToCP1252, &name);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	cell params[3] = { 2 * sizeof(cell), playerid };
+	scratch_mark mark = _scratchMark();
+	cell *addr = _scratchAllot(strlen(name) + 1, &params[2]);
+	if (addr != NULL)
+	{
+		amx_SetString(addr, name, 0, 0, strlen(name) + 1);
+		// the server may refuse or shorten the name, so read it back
+		if (_setPlayerName(m_AMX, params) == 1 && _validPlayer(playerid) && m_playerType[playerid] != PLAYER_NONE)
+			_identityRead(playerid, IDENTITY_NAME);
+	}
+	_scratchRelease(mark);
+	free(name);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+	Py_RETURN_NONE;
+}
+
+// picks up players who connected before Python was loaded (e.g. from a filterscript)
+void _playersInit()
+{
+	m_playersLock.Lock();
+	m_playerCount = 0;
+	memset(m_playerType, PLAYER_NONE, sizeof(m_playerType));
+	m_playersLock.Unlock();
+
+	cell params[2] = { sizeof(cell) };
+	for (cell id = 0; id < MAX_PLAYERS; id++)
+	{
+		params[1] = id;
+		if (_isPlayerConnected(m_AMX, params))
+			_playerConnect(id);
+	}
+}
+
+void _playerConnect(cell playerid)
+{
+	if (!_validPlayer(playerid))
+		return;
+
+	cell params[2] = { sizeof(cell), playerid };
+	char type = _isPlayerNPC(m_AMX, params) ? PLAYER_NPC : PLAYER_HUMAN;
+
+	for (int field = 0; field < IDENTITY_FIELDS; field++)
+		_identityRead(playerid, field);
+
+	m_playersLock.Lock();
+	if (m_playerType[playerid] == PLAYER_NONE)
+	{
+		int i = m_playerCount;
+		while (i > 0 && m_players[i - 1] > playerid)
+		{
+			m_players[i] = m_players[i - 1];
+			i--;
+		}
+		m_players[i] = playerid;
+		m_playerCount++;
+	}
+	m_playerType[playerid] = type;
+	m_playersLock.Unlock();
+}
+
+void _playerDisconnect(cell playerid)
+{
+	if (!_validPlayer(playerid))
+		return;
+
+	m_playersLock.Lock();
+	if (m_playerType[playerid] != PLAYER_NONE)
+	{
+		int i = 0;
+		while (m_players[i] != playerid)
+			i++;
+		memmove(&m_players[i], &m_players[i + 1], (m_playerCount - i - 1) * sizeof(cell));
+		m_playerCount--;
+		m_playerType[playerid] = PLAYER_NONE;
+	}
+	m_playersLock.Unlock();
+}
+
+// copies the sorted ids of all connected players to ids (MAX_PLAYERS cells), returns their count
+int _playersCopy(cell *ids)
+{
+	m_playersLock.Lock();
+	int count = m_playerCount;
+	memcpy(ids, m_players, count * sizeof(cell));
+	m_playersLock.Unlock();
+	return count;
+}
+
+// IsPlayerConnected(playerid)
+PyObject *sIsPlayerConnected(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	long playerid;
+	_pyParseFast(args, nargs, "l", &playerid);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	return PyLong_FromLong(_validPlayer(playerid) && m_playerType[playerid] != PLAYER_NONE);
+}
+
+// IsPlayerNPC(playerid)
+PyObject *sIsPlayerNPC(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	long playerid;
+	_pyParseFast(args, nargs, "l", &playerid);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	return PyLong_FromLong(_validPlayer(playerid) && m_playerType[playerid] == PLAYER_NPC);
+}
+
+// connected_players(npcs = None)
+// returns the sorted ids of all connected players as array('i');
+// npcs = False returns only humans, npcs = True only NPCs
+PyObject *sConnectedPlayers(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	PyObject *npcs = Py_None;
+	_pyParseFast(args, nargs, "|O", &npcs);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	int truth = npcs == Py_None ? 0 : PyObject_IsTrue(npcs);
+	if (truth == -1)
+		return NULL;
+
+	cell ids[MAX_PLAYERS];
+	int count = 0;
+
+	m_playersLock.Lock();
+	if (npcs == Py_None)
+	{
+		count = m_playerCount;
+		memcpy(ids, m_players, count * sizeof(cell));
+	}
+	else
+	{
+		char type = truth ? PLAYER_NPC : PLAYER_HUMAN;
+		for (int i = 0; i < m_playerCount; i++)
+		{
+			if (m_playerType[m_players[i]] == type)
+				ids[count++] = m_players[i];
+		}
+	}
+	m_playersLock.Unlock();
+
+	return _pyNewArray("i", ids, count * sizeof(cell));
+}
+
+//-----------------------------------------
+// bulk queries
+//-----------------------------------------
+
+// a player value GetPlayersField can return: either the return value of the native
+// or (for out) the float it writes to its second param
+struct player_field
+{
+	const char *name;
+	amx_function_t *native;
+	const char *typecode;	// array.array typecode of the result
+	bool out;
+};
+
+static const player_field _playerFields[] =
+{
+	{ "health",			&_getPlayerHealth,			"f", true },
+	{ "armour",			&_getPlayerArmour,			"f", true },
+	{ "angle",			&_getPlayerFacingAngle,		"f", true },
+	{ "score",			&_getPlayerScore,			"i", false },
+	{ "money",			&_getPlayerMoney,			"i", false },
+	{ "interior",		&_getPlayerInterior,		"i", false },
+	{ "virtualworld",	&_getPlayerVirtualWorld,	"i", false },
+	{ "vehicle",		&_getPlayerVehicleID,		"i", false },
+	{ "state",			&_getPlayerState,			"i", false },
+	{ "team",			&_getPlayerTeam,			"i", false },
+	{ "skin",			&_getPlayerSkin,			"i", false },
+	{ "weapon",			&_getPlayerWeapon,			"i", false },
+	{ "ping",			&_getPlayerPing,			"i", false },
+	{ "wantedlevel",	&_getPlayerWantedLevel,		"i", false },
+	{ "specialaction",	&_getPlayerSpecialAction,	"i", false },
+	{ "drunklevel",		&_getPlayerDrunkLevel,		"i", false },
+	{ "color",			&_getPlayerColor,			"I", false },
+	{ NULL, NULL, NULL, false }
+};
+
+// copies the player ids of a Python iterable to ids
+static bool _pyGetPlayerIds(PyObject *seq, std::vector<cell> &ids)
+{
+	PyObject *fast = PySequence_Fast(seq, "player ids must be iterable");
+	if (fast == NULL)
+		return false;
+
+	Py_ssize_t count = PySequence_Fast_GET_SIZE(fast);
+	PyObject **items = PySequence_Fast_ITEMS(fast);
+	ids.resize(count);
+	for (Py_ssize_t i = 0; i < count; i++)
+	{
+		long id = PyLong_AsLong(items[i]);
+		if (id == -1 && PyErr_Occurred())
+		{
+			Py_DECREF(fast);
+			return false;
+		}
+		ids[i] = id;
+	}
+	Py_DECREF(fast);
+	return true;
+}
+
+// GetPlayersPos(ids)
+// returns array('f', [x0, y0, z0, x1, y1, z1, ...]); players that aren't connected get zeros
+PyObject *sGetPlayersPos(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	PyObject *seq;
+	_pyParseFast(args, nargs, "O", &seq);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	std::vector<cell> ids;
+	if (!_pyGetPlayerIds(seq, ids))
+		return NULL;
+
+	std::vector<float> pos(ids.size() * 3, 0.0f);
+	cell params[5] = { 4 * sizeof(cell) };
+
+	scratch_mark mark = _scratchMark();
+	cell *out = _scratchAllot(3, &params[2]);
+	if (out == NULL)
+		return NULL;
+	params[3] = params[2] + sizeof(cell);
+	params[4] = params[3] + sizeof(cell);
+
+	for (size_t i = 0; i < ids.size(); i++)
+	{
+		params[1] = ids[i];
+		if (_getPlayerPos(m_AMX, params))
+		{
+			pos[i * 3] = amx_ctof(out[0]);
+			pos[i * 3 + 1] = amx_ctof(out[1]);
+			pos[i * 3 + 2] = amx_ctof(out[2]);
+		}
+	}
+	_scratchRelease(mark);
+
+	return _pyNewArray("f", pos.empty() ? NULL : &pos[0], pos.size() * sizeof(float));
+}
+
+// GetPlayersField(ids, field)
+// returns array('f') for health, armour and angle, array('I') for color and array('i') for
+// score, money, interior, virtualworld, vehicle, state, team, skin, weapon, ping,
+// wantedlevel, specialaction and drunklevel
+PyObject *sGetPlayersField(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	PyObject *seq;
+	const char *name;
+	_pyParseFast(args, nargs, "Os", &seq, &name);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	const player_field *field = _playerFields;
+	while (field->name != NULL && strcmp(field->name, name) != 0)
+		field++;
+
+	if (field->name == NULL)
+	{
+		PyErr_Format(PyExc_ValueError, "unknown player field '%s'", name);
+		return NULL;
+	}
+
+	std::vector<cell> ids;
+	if (!_pyGetPlayerIds(seq, ids))
+		return NULL;
+
+	// cells and floats are both 32 bit, so the raw cells can be handed to array.array
+	std::vector<cell> values(ids.size(), 0);
+	amx_function_t native = *field->native;
+	cell params[3] = { sizeof(cell) };
+
+	if (field->out)
+	{
+		params[0] = 2 * sizeof(cell);
+		scratch_mark mark = _scratchMark();
+		cell *out = _scratchAllot(1, &params[2]);
+		if (out == NULL)
+			return NULL;
+
+		for (size_t i = 0; i < ids.size(); i++)
+		{
+			params[1] = ids[i];
+			*out = 0;
+			native(m_AMX, params);
+			values[i] = *out;
+		}
+		_scratchRelease(mark);
+	}
+	else
+	{
+		for (size_t i = 0; i < ids.size(); i++)
+		{
+			params[1] = ids[i];
+			values[i] = native(m_AMX, params);
+		}
+	}
+
+	return _pyNewArray(field->typecode, values.empty() ? NULL : &values[0], values.size() * sizeof(cell));
+}
+
+//-----------------------------------------
+// message fan-out
+//-----------------------------------------
+
+static PyObject *_sendClientMessages(const std::vector<cell> &ids, PyObject *color, PyObject *msg)
+{
+	cell params[4] = { 3 * sizeof(cell) };
+	Py_ssize_t size = _cp1252Size(msg);
+	if (size == -1 || !p_color::convert(color, &params[2]))
+		return NULL;
+
+	scratch_mark mark = _scratchMark();
+	cell *addr = _scratchAllot((int)size, &params[3]);
+	bool ok = addr != NULL && _cp1252ToCells(msg, addr, size);
+	if (ok)
+	{
+		for (size_t i = 0; i < ids.size(); i++)
+		{
+			params[1] = ids[i];
+			_sendClientMessage(m_AMX, params);
+		}
+	}
+	_scratchRelease(mark);
+
+	if (!ok)
+		return NULL;
+	Py_RETURN_NONE;
+}
+
+// SendClientMessageMany(playerids, color, message)
+// playerids can be any iterable of ids: a list, set, range, connected_players(), ...
+PyObject *sSendClientMessageMany(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	PyObject *seq, *color, *msg;
+	_pyParseFast(args, nargs, "OOO", &seq, &color, &msg);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	std::vector<cell> ids;
+	if (!_pyGetPlayerIds(seq, ids))
+		return NULL;
+
+	return _sendClientMessages(ids, color, msg);
+}
+
+// SendClientMessageMask(mask, color, message)
+// mask is a bitset of player ids: an int (bit n is player n) or a bytes-like object
+// (bit n % 8 of byte n / 8 is player n), e.g. a bytearray(MAX_PLAYERS // 8 + 1)
+PyObject *sSendClientMessageMask(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	PyObject *mask, *color, *msg;
+	_pyParseFast(args, nargs, "OOO", &mask, &color, &msg);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	PyObject *bytes = NULL;
+	if (PyLong_Check(mask))
+	{
+		bytes = PyObject_CallMethod(mask, "to_bytes", "is", (MAX_PLAYERS + 7) / 8, "little");
+		if (bytes == NULL)
+			return NULL;
+		mask = bytes;
+	}
+
+	Py_buffer view;
+	if (PyObject_GetBuffer(mask, &view, PyBUF_SIMPLE) == -1)
+	{
+		Py_XDECREF(bytes);
+		return NULL;
+	}
+
+	std::vector<cell> ids;
+	const unsigned char *bits = (const unsigned char *)view.buf;
+	for (cell id = 0; id < MAX_PLAYERS && id / 8 < view.len; id++)
+	{
+		if (bits[id / 8] & (1 << (id % 8)))
+			ids.push_back(id);
+	}
+	PyBuffer_Release(&view);
+	Py_XDECREF(bytes);
+
+	return _sendClientMessages(ids, color, msg);
+}
+
+//-----------------------------------------
+// snapshot
+//-----------------------------------------
+
+// filled by ProcessTick on the server thread; Python only ever gets read-only views of it.
+// Worker threads reading it while a capture runs may see values of two different ticks.
+bool m_snapshotEnabled = false;
+player_snapshot m_snapshot;
+
+struct snapshot_column
+{
+	const char *name;
+	void *data;
+	const char *format;
+};
+
+static const snapshot_column _snapshotColumns[] =
+{
+	{ "id",			m_snapshot.id,			"i" },
+	{ "x",			m_snapshot.x,			"f" },
+	{ "y",			m_snapshot.y,			"f" },
+	{ "z",			m_snapshot.z,			"f" },
+	{ "vx",			m_snapshot.vx,			"f" },
+	{ "vy",			m_snapshot.vy,			"f" },
+	{ "vz",			m_snapshot.vz,			"f" },
+	{ "health",		m_snapshot.health,		"f" },
+	{ "armour",		m_snapshot.armour,		"f" },
+	{ "state",		m_snapshot.state,		"i" },
+	{ "vehicle",	m_snapshot.vehicle,		"i" },
+	{ "world",		m_snapshot.world,		"i" },
+	{ "interior",	m_snapshot.interior,	"i" },
+	{ "weapon",		m_snapshot.weapon,		"i" },
+	{ "keys",		m_snapshot.keys,		"i" },
+	{ "updown",		m_snapshot.updown,		"i" },
+	{ "leftright",	m_snapshot.leftright,	"i" },
+	{ NULL, NULL, NULL }
+};
+
+// called by ProcessTick, without the GIL
+void _snapshotCapture()
+{
+	if (!m_snapshotEnabled || m_AMX == NULL)
+		return;
+
+	// not _scratchAllot: that raises Python exceptions, and we don't hold the GIL here.
+	// ProcessTick runs outside of Pawn code, so allotting is safe.
+	cell base, *out;
+	if (amx_Allot(m_AMX, 3, &base, &out) != AMX_ERR_NONE)
+		return;
+
+	cell one[2] = { sizeof(cell) };
+	cell two[3] = { 2 * sizeof(cell), 0, base };
+	cell four[5] = { 4 * sizeof(cell), 0, base, base + sizeof(cell), base + 2 * sizeof(cell) };
+
+	cell players[MAX_PLAYERS];
+	int count = _playersCopy(players), n = 0;
+	for (int i = 0; i < count; i++)
+	{
+		cell id = players[i];
+		one[1] = two[1] = four[1] = id;
+		m_snapshot.id[n] = id;
+		m_snapshot.state[n] = _getPlayerState(m_AMX, one);
+		m_snapshot.vehicle[n] = _getPlayerVehicleID(m_AMX, one);
+		m_snapshot.world[n] = _getPlayerVirtualWorld(m_AMX, one);
+		m_snapshot.interior[n] = _getPlayerInterior(m_AMX, one);
+		m_snapshot.weapon[n] = _getPlayerWeapon(m_AMX, one);
+
+		_getPlayerPos(m_AMX, four);
+		m_snapshot.x[n] = amx_ctof(out[0]);
+		m_snapshot.y[n] = amx_ctof(out[1]);
+		m_snapshot.z[n] = amx_ctof(out[2]);
+
+		if (m_snapshot.vehicle[n] != 0)
+		{
+			four[1] = m_snapshot.vehicle[n];
+			_getVehicleVelocity(m_AMX, four);
+			four[1] = id;
+		}
+		else
+			_getPlayerVelocity(m_AMX, four);
+		m_snapshot.vx[n] = amx_ctof(out[0]);
+		m_snapshot.vy[n] = amx_ctof(out[1]);
+		m_snapshot.vz[n] = amx_ctof(out[2]);
+
+		_getPlayerHealth(m_AMX, two);
+		m_snapshot.health[n] = amx_ctof(out[0]);
+		_getPlayerArmour(m_AMX, two);
+		m_snapshot.armour[n] = amx_ctof(out[0]);
+
+		_getPlayerKeys(m_AMX, four);
+		m_snapshot.keys[n] = out[0];
+		m_snapshot.updown[n] = out[1];
+		m_snapshot.leftright[n] = out[2];
+		n++;
+	}
+	amx_Release(m_AMX, base);
+
+	m_snapshot.count = n;
+	m_snapshot.tick = GetTickCount();
+}
+
+// enable_snapshot(enabled)
+// the first snapshot is taken on the next server tick
+PyObject *sEnableSnapshot(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	int enabled;
+	_pyParseFast(args, nargs, "p", &enabled);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	m_snapshotEnabled = enabled != 0;
+	if (!m_snapshotEnabled)
+		m_snapshot.count = 0;
+	Py_RETURN_NONE;
+}
+
+// snapshot()
+// returns { "tick": tick, "id": ids, "x": xs, ... } with a read-only memoryview per value,
+// all of them as long as the number of connected players (row i is player id[i]);
+// the views are updated in place every tick, copy them to keep values.
+// Returns None while snapshots are disabled.
+PyObject *sSnapshot(PyObject *self, PyObject *args)
+{
+	if (!m_snapshotEnabled)
+		Py_RETURN_NONE;
+
+	PyObject *ret = PyDict_New();
+	if (ret == NULL)
+		return NULL;
+
+	PyObject *tick = PyLong_FromUnsignedLongLong(m_snapshot.tick);
+	if (tick == NULL || PyDict_SetItemString(ret, "tick", tick) == -1)
+	{
+		Py_XDECREF(tick);
+		Py_DECREF(ret);
+		return NULL;
+	}
+	Py_DECREF(tick);
+
+	for (const snapshot_column *c = _snapshotColumns; c->name != NULL; c++)
+	{
+		PyObject *view = _pyNewView(c->data, m_snapshot.count, c->format, 4);
+		if (view == NULL || PyDict_SetItemString(ret, c->name, view) == -1)
+		{
+			Py_XDECREF(view);
+			Py_DECREF(ret);
+			return NULL;
+		}
+		Py_DECREF(view);
+	}
+	return ret;
+}
@@ -0,0 +1,73 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef __players_h_
+#define __players_h_
+
+#include "constants.h"
+
+// connected players, kept up to date by OnPlayerConnect / OnPlayerDisconnect
+#define PLAYER_NONE		0
+#define PLAYER_HUMAN	1
+#define PLAYER_NPC		2
+
+void _playersInit();
+void _playerConnect(cell playerid);
+void _playerDisconnect(cell playerid);
+int _playersCopy(cell *ids);
+void _playersClearCache();
+
+PyObject *sIsPlayerConnected(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sIsPlayerNPC(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sConnectedPlayers(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+
+// name, IP and version of connected players, read once at connect
+PyObject *sGetPlayerName(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sGetPlayerIp(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sGetPlayerVersion(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sSetPlayerName(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+
+// bulk queries: one call from Python loops over many players in C++
+PyObject *sGetPlayersPos(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sGetPlayersField(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+
+// one message to many players, encoded and copied to the AMX once
+PyObject *sSendClientMessageMany(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sSendClientMessageMask(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+
+// per-tick snapshot of all connected players, as one array per value
+struct player_snapshot
+{
+	int count;					// players in the last capture
+	unsigned long long tick;	// GetTickCount() of the last capture
+	cell id[MAX_PLAYERS];
+	float x[MAX_PLAYERS], y[MAX_PLAYERS], z[MAX_PLAYERS];
+	float vx[MAX_PLAYERS], vy[MAX_PLAYERS], vz[MAX_PLAYERS];	// vehicle velocity while driving
+	float health[MAX_PLAYERS], armour[MAX_PLAYERS];
+	cell state[MAX_PLAYERS], vehicle[MAX_PLAYERS], world[MAX_PLAYERS], interior[MAX_PLAYERS], weapon[MAX_PLAYERS];
+	cell keys[MAX_PLAYERS], updown[MAX_PLAYERS], leftright[MAX_PLAYERS];
+};
+
+extern bool m_snapshotEnabled;
+extern player_snapshot m_snapshot;
+
+void _snapshotCapture();
+
+PyObject *sEnableSnapshot(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sSnapshot(PyObject *self, PyObject *args);
+
+#endif
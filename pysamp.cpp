@@ -16,9 +16,16 @@
 
 #include "pythonplugin.h"
 #include <frameobject.h> // used for building the traceback
+#include <structmember.h> // PyMemberDef, for the field names of Vec3 and Quat
 #include "nativefunctions.h"
 #include "pysamp.h"
 #include "constants.h"
+#include "players.h"
+#include "compiledcall.h"
+#include "nativeprofile.h"
+#include "textdraws.h"
+#include "playerdata.h"
+#include "spatial.h"
 
 // ----------------------------------
 // python module for the samp functions
@@ -26,345 +33,381 @@
 
 PyMethodDef _pySampMethods[] =
 {
-	{ "printf", sPrintf, METH_VARARGS, "Prints to the log" },
-
-	{ "AddMenuItem", sAddMenuItem, METH_VARARGS, "" },
-	{ "AddPlayerClass", sAddPlayerClass, METH_VARARGS, "Adds a class to the class selection" },
-	{ "AddPlayerClassEx", sAddPlayerClassEx, METH_VARARGS, "" },
-	{ "AddStaticPickup", sAddStaticPickup, METH_VARARGS, "Adds a static pickup" },
-	{ "AddStaticVehicle", sAddStaticVehicle, METH_VARARGS, "" },
-	{ "AddStaticVehicleEx", sAddStaticVehicleEx, METH_VARARGS, "" },
-	{ "AddVehicleComponent", sAddVehicleComponent, METH_VARARGS, "Adds a vehicle component" },
-	{ "AllowAdminTeleport", sAllowAdminTeleport, METH_VARARGS, "" },
-	{ "AllowInteriorWeapons", sAllowInteriorWeapons, METH_VARARGS, "Allows to use weapons in interiors" },
-	{ "AllowPlayerTeleport", sAllowPlayerTeleport, METH_VARARGS, "" },
-	{ "ApplyAnimation", sApplyAnimation, METH_VARARGS, "Applies an animation to a player" },
-	{ "Attach3DTextLabelToPlayer", sAttach3DTextLabelToPlayer, METH_VARARGS, "" },
-	{ "Attach3DTextLabelToVehicle", sAttach3DTextLabelToVehicle, METH_VARARGS, "" },
-	{ "AttachCameraToObject", sAttachCameraToObject, METH_VARARGS, "" },
-	{ "AttachCameraToPlayerObject", sAttachCameraToPlayerObject, METH_VARARGS, "" },
-	{ "AttachObjectToObject", sAttachObjectToObject, METH_VARARGS, "" },
-	{ "AttachObjectToPlayer", sAttachObjectToPlayer, METH_VARARGS, "" },
-	{ "AttachObjectToVehicle", sAttachObjectToVehicle, METH_VARARGS, "" },
-	{ "AttachPlayerObjectToPlayer", sAttachPlayerObjectToPlayer, METH_VARARGS, "" },
-	{ "AttachPlayerObjectToVehicle", sAttachPlayerObjectToVehicle, METH_VARARGS, "" },
-	{ "AttachTrailerToVehicle", sAttachTrailerToVehicle, METH_VARARGS, "" },
-
-	{ "Ban", sBan, METH_VARARGS, "Bans a player" },
-	{ "BanEx", sBanEx, METH_VARARGS, "Bans a player with a reason" },
-
-	{ "CallRemoteFunction", sCallRemoteFunction, METH_VARARGS, "Call a public Pawn function by name" },
-	{ "CallNativeFunction", sCallNativeFunction, METH_VARARGS, "Call a native Pawn function by name" },
-
-	{ "CancelEdit", sCancelEdit, METH_VARARGS, "" },
-	{ "CancelSelectTextDraw", sCancelSelectTextDraw, METH_VARARGS, "" },
-	{ "ChangeVehicleColor", sChangeVehicleColor, METH_VARARGS, "Changes a vehicle's colors" },
-	{ "ChangeVehiclePaintjob", sChangeVehiclePaintjob, METH_VARARGS, "Changes a vehicle's paintjob" },
-	{ "ClearAnimations", sClearAnimations, METH_VARARGS, "Clears all animations for a player" },
-	{ "ConnectNPC", sConnectNPC, METH_VARARGS, "Connects a NPC to the server" },
-	{ "Create3DTextLabel", sCreate3DTextLabel, METH_VARARGS, "" },
-	{ "CreateExplosion", sCreateExplosion, METH_VARARGS, "Creates an explosion" },
-	{ "CreateMenu", sCreateMenu, METH_VARARGS, "" },
-	{ "CreateObject", sCreateObject, METH_VARARGS, "Creates an object" },
-	{ "CreatePickup", sCreatePickup, METH_VARARGS, "Creates a pickup" },
-	{ "CreatePlayer3DTextLabel", sCreatePlayer3DTextLabel, METH_VARARGS, "" },
-	{ "CreatePlayerObject", sCreatePlayerObject, METH_VARARGS, "Creates a player object" },
-	{ "CreateVehicle", sCreateVehicle, METH_VARARGS, "Creates a vehicle" },
-
-	{ "Delete3DTextLabel", sDelete3DTextLabel, METH_VARARGS, "Deletes a 3D text label" },
-	{ "DeletePlayer3DTextLabel", sDeletePlayer3DTextLabel, METH_VARARGS, "Deletes a player 3D text label" },
-	{ "DeletePVar", sDeletePVar, METH_VARARGS, "" },
-	{ "DestroyMenu", sDestroyMenu, METH_VARARGS, "Destroys a menu" },
-	{ "DestroyObject", sDestroyObject, METH_VARARGS, "Destroys an object" },
-	{ "DestroyPickup", sDestroyPickup, METH_VARARGS, "Destroys a pickup" },
-	{ "DestroyPlayerObject", sDestroyPlayerObject, METH_VARARGS, "Destroys a player object" },
-	{ "DestroyVehicle", sDestroyVehicle, METH_VARARGS, "Destroys a vehicle" },
-	{ "DetachTrailerFromVehicle", sDetachTrailerFromVehicle, METH_VARARGS, "Detaches a trailer from a vehicle" },
-	{ "DisableInteriorEnterExits", sDisableInteriorEnterExits, METH_VARARGS, "Disables interior entrances" },
-	{ "DisableMenu", sDisableMenu, METH_VARARGS, "Disables a menu" },
-	{ "DisableMenuRow", sDisableMenuRow, METH_VARARGS, "Disables a menu row" },
-	{ "DisableNameTagLOS", sDisableNameTagLOS, METH_VARARGS, "Disables name tag line of sight" },
-	{ "DisablePlayerCheckpoint", sDisablePlayerCheckpoint, METH_VARARGS, "Disables a player's checkpoint" },
-	{ "DisablePlayerRaceCheckpoint", sDisablePlayerRaceCheckpoint, METH_VARARGS, "Disables a player's race checkpoint" },
-
-	{ "EditObject", sEditObject, METH_VARARGS, "" },
-	{ "EditPlayerObject", sEditPlayerObject, METH_VARARGS, "" },
-	{ "EditAttachedObject", sEditAttachedObject, METH_VARARGS, "" },
-	{ "EnableStuntBonusForAll", sEnableStuntBonusForAll, METH_VARARGS, "Enables/disables stunt bonus for everyone" },
-	{ "EnableStuntBonusForPlayer", sEnableStuntBonusForPlayer, METH_VARARGS, "Enables/disables stunt bonus for a player" },
-	{ "EnableVehicleFriendlyFire", sEnableVehicleFriendlyFire, METH_VARARGS, "" },
-	{ "ForceClassSelection", sForceClassSelection, METH_VARARGS, "Forces a player to the class selection after the next death" },
-
-	{ "GameModeExit", sGameModeExit, METH_VARARGS, "Exits the current gamemode" },
-	{ "GameTextForAll", sGameTextForAll, METH_VARARGS, "Sends a game text for everyone" },
-	{ "GameTextForPlayer", sGameTextForPlayer, METH_VARARGS, "Sends a game text for a player" },
-	{ "GangZoneCreate", sGangZoneCreate, METH_VARARGS, "Creates a gang zone" },
-	{ "GangZoneDestroy", sGangZoneDestroy, METH_VARARGS, "Destroys a gang zone" },
-	{ "GangZoneFlashForAll", sGangZoneFlashForAll, METH_VARARGS, "Flashes a gang zone for everyone" },
-	{ "GangZoneFlashForPlayer", sGangZoneFlashForPlayer, METH_VARARGS, "Flashes a gang zone for a player" },
-	{ "GangZoneHideForAll", sGangZoneHideForAll, METH_VARARGS, "Hides a gang zone for everyone" },
-	{ "GangZoneHideForPlayer", sGangZoneHideForPlayer, METH_VARARGS, "Hides a gang zone for a player" },
-	{ "GangZoneShowForAll", sGangZoneShowForAll, METH_VARARGS, "Shows a gang zone for everyone" },
-	{ "GangZoneShowForPlayer", sGangZoneShowForPlayer, METH_VARARGS, "Shows a gang zone for a player" },
-	{ "GangZoneStopFlashForAll", sGangZoneStopFlashForAll, METH_VARARGS, "Stops flashing a gang zone for everyone" },
-	{ "GangZoneStopFlashForPlayer", sGangZoneStopFlashForPlayer, METH_VARARGS, "Stops flashing a gang zone for a player" },
-	{ "GetAnimationName", sGetAnimationName, METH_VARARGS, "Returns the name of an animation" },
-	{ "GetMaxPlayers", sGetMaxPlayers, METH_VARARGS, "Gets the max player value." },
-	{ "GetNetworkStats", sGetNetworkStats, METH_VARARGS, "" },
-	{ "GetObjectPos", sGetObjectPos, METH_VARARGS, "Gets an object's position" },
-	{ "GetObjectRot", sGetObjectRot, METH_VARARGS, "Gets an object's rotation" },
-	{ "GetPlayerAmmo", sGetPlayerAmmo, METH_VARARGS, "Gets a player's current amount of ammo" },
-	{ "GetPlayerAnimationIndex", sGetPlayerAnimationIndex, METH_VARARGS, "Gets a player's animation index of an animation currently running" },
-	{ "GetPlayerArmour", sGetPlayerArmour, METH_VARARGS, "Gets a player's armour" },
-	{ "GetPlayerCameraFrontVector", sGetPlayerCameraFrontVector, METH_VARARGS, "Gets a relative position to the camera position of the player's aiming" },
-	{ "GetPlayerCameraMode", sGetPlayerCameraMode, METH_VARARGS, "" },
-	{ "GetPlayerCameraPos", sGetPlayerCameraPos, METH_VARARGS, "Gets the current camera position of a player" },
-	{ "GetPlayerColor", sGetPlayerColor, METH_VARARGS, "Gets a player's color" },
-	{ "GetPlayerDistanceFromPoint", sGetPlayerDistanceFromPoint, METH_VARARGS, "" },
-	{ "GetPlayerDrunkLevel", sGetPlayerDrunkLevel, METH_VARARGS, "Gets a player's current drunk level" },
-	{ "GetPlayerFacingAngle", sGetPlayerFacingAngle, METH_VARARGS, "Gets a player's current facing angle" },
-	{ "GetPlayerFightingStyle", sGetPlayerFightingStyle, METH_VARARGS, "Gets a player's current fighting style" },
-	{ "GetPlayerHealth", sGetPlayerHealth, METH_VARARGS, "Gets a player's current health" },
-	{ "GetPlayerInterior", sGetPlayerInterior, METH_VARARGS, "Gets a player's current interior" },
-	{ "GetPlayerIp", sGetPlayerIp, METH_VARARGS, "Gets a player's ip" },
-	{ "GetPlayerKeys", sGetPlayerKeys, METH_VARARGS, "Gets keys currently pressed by a player" },
-	{ "GetPlayerMenu", sGetPlayerMenu, METH_VARARGS, "Gets a player's current menu" },
-	{ "GetPlayerMoney", sGetPlayerMoney, METH_VARARGS, "Gets a player's current amount of money" },
-	{ "GetPlayerName", sGetPlayerName, METH_VARARGS, "Gets a player's name" },
-	{ "GetPlayerNetworkStats", sGetPlayerNetworkStats, METH_VARARGS, "" },
-	{ "GetPlayerObjectPos", sGetPlayerObjectPos, METH_VARARGS, "Gets a player object's position" },
-	{ "GetPlayerObjectRot", sGetPlayerObjectRot, METH_VARARGS, "Gets a player object's rotation" },
-	{ "GetPlayerPing", sGetPlayerPing, METH_VARARGS, "Gets a player's current ping" },
-	{ "GetPlayerPos", sGetPlayerPos, METH_VARARGS, "Gets a player's position" },
-	{ "GetPlayerScore", sGetPlayerScore, METH_VARARGS, "" },
-	{ "GetPlayerSkin", sGetPlayerSkin, METH_VARARGS, "" },
-	{ "GetPlayerSpecialAction", sGetPlayerSpecialAction, METH_VARARGS, "" },
-	{ "GetPlayerState", sGetPlayerState, METH_VARARGS, "" },
-	{ "GetPlayerSurfingObjectID", sGetPlayerSurfingObjectID, METH_VARARGS, "" },
-	{ "GetPlayerSurfingVehicleID", sGetPlayerSurfingVehicleID, METH_VARARGS, "" },
-	{ "GetPlayerTargetPlayer", sGetPlayerTargetPlayer, METH_VARARGS, "" },
-	{ "GetPlayerTeam", sGetPlayerTeam, METH_VARARGS, "" },
-	{ "GetPlayerTime", sGetPlayerTime, METH_VARARGS, "" },
-	{ "GetPlayerVehicleID", sGetPlayerVehicleID, METH_VARARGS, "" },
-	{ "GetPlayerVehicleSeat", sGetPlayerVehicleSeat, METH_VARARGS, "" },
-	{ "GetPlayerVelocity", sGetPlayerVelocity, METH_VARARGS, "" },
-	{ "GetPlayerVersion", sGetPlayerVersion, METH_VARARGS, "" },
-	{ "GetPlayerVirtualWorld", sGetPlayerVirtualWorld, METH_VARARGS, "" },
-	{ "GetPlayerWantedLevel", sGetPlayerWantedLevel, METH_VARARGS, "" },
-	{ "GetPlayerWeapon", sGetPlayerWeapon, METH_VARARGS, "" },
-	{ "GetPlayerWeaponData", sGetPlayerWeaponData, METH_VARARGS, "" },
-	{ "GetPlayerWeaponState", sGetPlayerWeaponState, METH_VARARGS, "" },
-	{ "GetPVarFloat", sGetPVarFloat, METH_VARARGS, "" },
-	{ "GetPVarInt", sGetPVarInt, METH_VARARGS, "" },
-	{ "GetPVarString", sGetPVarString, METH_VARARGS, "" },
-	{ "GetTickCount", sGetTickCount, METH_VARARGS, "" },
-	{ "GetVehicleComponentInSlot", sGetVehicleComponentInSlot, METH_VARARGS, "" },
-	{ "GetVehicleComponentType", sGetVehicleComponentType, METH_VARARGS, "" },
-	{ "GetVehicleDamageStatus", sGetVehicleDamageStatus, METH_VARARGS, "" },
-	{ "GetVehicleDistanceFromPoint", sGetVehicleDistanceFromPoint, METH_VARARGS, "" },
-	{ "GetVehicleHealth", sGetVehicleHealth, METH_VARARGS, "" },
-	{ "GetVehicleModel", sGetVehicleModel, METH_VARARGS, "" },
-	{ "GetVehicleModelInfo", sGetVehicleModelInfo, METH_VARARGS, "" },
-	{ "GetVehiclePos", sGetVehiclePos, METH_VARARGS, "" },
-	{ "GetVehicleRotationQuat", sGetVehicleRotationQuat, METH_VARARGS, "" },
-	{ "GetVehicleTrailer", sGetVehicleTrailer, METH_VARARGS, "" },
-	{ "GetVehicleVelocity", sGetVehicleVelocity, METH_VARARGS, "" },
-	{ "GetVehicleVirtualWorld", sGetVehicleVirtualWorld, METH_VARARGS, "" },
-	{ "GetVehicleZAngle", sGetVehicleZAngle, METH_VARARGS, "" },
-	{ "GetWeaponName", sGetWeaponName, METH_VARARGS, "" },
-	{ "GivePlayerMoney", sGivePlayerMoney, METH_VARARGS, "" },
-	{ "GivePlayerWeapon", sGivePlayerWeapon, METH_VARARGS, "" },
-
-	{ "HideMenuForPlayer", sHideMenuForPlayer, METH_VARARGS, "" },
-
-	{ "InterpolateCameraPos", sInterpolateCameraPos, METH_VARARGS, "" },
-	{ "InterpolateCameraLookAt", sInterpolateCameraLookAt, METH_VARARGS, "" },
-	{ "IsObjectMoving", sIsObjectMoving, METH_VARARGS, "" },
-	{ "IsPlayerAdmin", sIsPlayerAdmin, METH_VARARGS, "" },
-	{ "IsPlayerAttachedObjectSlotUsed", sIsPlayerAttachedObjectSlotUsed, METH_VARARGS, "" },
-	{ "IsPlayerConnected", sIsPlayerConnected, METH_VARARGS, "" },
-	{ "IsPlayerHoldingObject", sIsPlayerHoldingObject, METH_VARARGS, "" },
-	{ "IsPlayerInAnyVehicle", sIsPlayerInAnyVehicle, METH_VARARGS, "" },
-	{ "IsPlayerInCheckpoint", sIsPlayerInCheckpoint, METH_VARARGS, "" },
-	{ "IsPlayerInRaceCheckpoint", sIsPlayerInRaceCheckpoint, METH_VARARGS, "" },
-	{ "IsPlayerInRangeOfPoint", sIsPlayerInRangeOfPoint, METH_VARARGS, "" },
-	{ "IsPlayerInVehicle", sIsPlayerInVehicle, METH_VARARGS, "" },
-	{ "IsPlayerNPC", sIsPlayerNPC, METH_VARARGS, "" },
-	{ "IsPlayerObjectMoving", sIsPlayerObjectMoving, METH_VARARGS, "" },
-	{ "IsPlayerStreamedIn", sIsPlayerStreamedIn, METH_VARARGS, "" },
-	{ "IsTrailerAttachedToVehicle", sIsTrailerAttachedToVehicle, METH_VARARGS, "" },
-	{ "IsValidMenu", sIsValidMenu, METH_VARARGS, "" },
-	{ "IsValidObject", sIsValidObject, METH_VARARGS, "" },
-	{ "IsValidPlayerObject", sIsValidPlayerObject, METH_VARARGS, "" },
-	{ "IsVehicleStreamedIn", sIsVehicleStreamedIn, METH_VARARGS, "" },
-
-	{ "Kick", sKick, METH_VARARGS, "Kick a specified player from the server" },
-	{ "KillTimer", sKillTimer, METH_VARARGS, "Kills a timer" },
-
-	{ "LimitGlobalChatRadius", sLimitGlobalChatRadius, METH_VARARGS, "" },
-	{ "LimitPlayerMarkerRadius", sLimitPlayerMarkerRadius, METH_VARARGS, "" },
-	{ "LinkVehicleToInterior", sLinkVehicleToInterior, METH_VARARGS, "" },
-
-	{ "ManualVehicleEngineAndLights", sManualVehicleEngineAndLights, METH_VARARGS, "" },
-	{ "MoveObject", sMoveObject, METH_VARARGS, "" },
-	{ "MovePlayerObject", sMovePlayerObject, METH_VARARGS, "" },
-
-	{ "PlayAudioStreamForPlayer", sPlayAudioStreamForPlayer, METH_VARARGS, "" },
-	{ "PlayCrimeReportForPlayer", sPlayCrimeReportForPlayer, METH_VARARGS, "" },
-	{ "PlayerPlaySound", sPlayerPlaySound, METH_VARARGS, "" },
-	{ "PlayerSpectatePlayer", sPlayerSpectatePlayer, METH_VARARGS, "" },
-	{ "PlayerSpectateVehicle", sPlayerSpectateVehicle, METH_VARARGS, "" },
-	{ "PutPlayerInVehicle", sPutPlayerInVehicle, METH_VARARGS, "" },
-
-	{ "CreatePlayerTextDraw", sCreatePlayerTextDraw, METH_VARARGS, "" },
-	{ "PlayerTextDrawDestroy", sPlayerTextDrawDestroy, METH_VARARGS, "" },
-	{ "PlayerTextDrawLetterSize", sPlayerTextDrawLetterSize, METH_VARARGS, "" },
-	{ "PlayerTextDrawTextSize", sPlayerTextDrawTextSize, METH_VARARGS, "" },
-	{ "PlayerTextDrawAlignment", sPlayerTextDrawAlignment, METH_VARARGS, "" },
-	{ "PlayerTextDrawColor", sPlayerTextDrawColor, METH_VARARGS, "" },
-	{ "PlayerTextDrawUseBox", sPlayerTextDrawUseBox, METH_VARARGS, "" },
-	{ "PlayerTextDrawBoxColor", sPlayerTextDrawBoxColor, METH_VARARGS, "" },
-	{ "PlayerTextDrawSetShadow", sPlayerTextDrawSetShadow, METH_VARARGS, "" },
-	{ "PlayerTextDrawSetOutline", sPlayerTextDrawSetOutline, METH_VARARGS, "" },
-	{ "PlayerTextDrawBackgroundColor", sPlayerTextDrawBackgroundColor, METH_VARARGS, "" },
-	{ "PlayerTextDrawFont", sPlayerTextDrawFont, METH_VARARGS, "" },
-	{ "PlayerTextDrawSetProportional", sPlayerTextDrawSetProportional, METH_VARARGS, "" },
-	{ "PlayerTextDrawSetSelectable", sPlayerTextDrawSetSelectable, METH_VARARGS, "" },
-	{ "PlayerTextDrawSetPreviewModel", sPlayerTextDrawSetPreviewModel, METH_VARARGS, "" },
-	{ "PlayerTextDrawSetPreviewRot", sPlayerTextDrawSetPreviewRot, METH_VARARGS, "" },
-	{ "PlayerTextDrawSetPreviewVehCol", sPlayerTextDrawSetPreviewVehCol, METH_VARARGS, "" },
-	{ "PlayerTextDrawShow", sPlayerTextDrawShow, METH_VARARGS, "" },
-	{ "PlayerTextDrawHide", sPlayerTextDrawHide, METH_VARARGS, "" },
-	{ "PlayerTextDrawSetString", sPlayerTextDrawSetString, METH_VARARGS, "" },
-
-	{ "RemoveBuildingForPlayer", sRemoveBuildingForPlayer, METH_VARARGS, "" },
-	{ "RemovePlayerAttachedObject", sRemovePlayerAttachedObject, METH_VARARGS, "" },
-	{ "RemovePlayerFromVehicle", sRemovePlayerFromVehicle, METH_VARARGS, "" },
-	{ "RemovePlayerMapIcon", sRemovePlayerMapIcon, METH_VARARGS, "" },
-	{ "RemoveVehicleComponent", sRemoveVehicleComponent, METH_VARARGS, "" },
-	{ "RepairVehicle", sRepairVehicle, METH_VARARGS, "" },
-	{ "ResetPlayerMoney", sResetPlayerMoney, METH_VARARGS, "" },
-	{ "ResetPlayerWeapons", sResetPlayerWeapons, METH_VARARGS, "" },
-
-	{ "SelectObject", sSelectObject, METH_VARARGS, "" },
-	{ "SelectTextDraw", sSelectTextDraw, METH_VARARGS, "" },
-	{ "SendClientMessage", sSendClientMessage, METH_VARARGS, "Sends a message to a player" },
-	{ "SendClientMessageToAll", sSendClientMessageToAll, METH_VARARGS, "" },
-	{ "SendDeathMessage", sSendDeathMessage, METH_VARARGS, "" },
-	{ "SendPlayerMessageToAll", sSendPlayerMessageToAll, METH_VARARGS, "" },
-	{ "SendPlayerMessageToPlayer", sSendPlayerMessageToPlayer, METH_VARARGS, "" },
-	{ "SendRconCommand", sSendRconCommand, METH_VARARGS, "" },
-	{ "SetCameraBehindPlayer", sSetCameraBehindPlayer, METH_VARARGS, "" },
-	{ "SetGameModeText", sSetGameModeText, METH_VARARGS, "Sets the gamemode text" },
-	{ "SetGravity", sSetGravity, METH_VARARGS, "Sets the gravity on the server" },
-	{ "SetMenuColumnHeader", sSetMenuColumnHeader, METH_VARARGS, "" },
-	{ "SetNameTagDrawDistance", sSetNameTagDrawDistance, METH_VARARGS, "" },
-	{ "SetObjectMaterial", sSetObjectMaterial, METH_VARARGS, "" },
-	{ "SetObjectMaterialText", sSetObjectMaterialText, METH_VARARGS, "" },
-	{ "SetObjectPos", sSetObjectPos, METH_VARARGS, "" },
-	{ "SetObjectRot", sSetObjectRot, METH_VARARGS, "" },
-	{ "SetPlayerAmmo", sSetPlayerAmmo, METH_VARARGS, "" },
-	{ "SetPlayerArmedWeapon", sSetPlayerArmedWeapon, METH_VARARGS, "" },
-	{ "SetPlayerArmour", sSetPlayerArmour, METH_VARARGS, "" },
-	{ "SetPlayerAttachedObject", sSetPlayerAttachedObject, METH_VARARGS, "" },
-	{ "SetPlayerCameraLookAt", sSetPlayerCameraLookAt, METH_VARARGS, "" },
-	{ "SetPlayerCameraPos", sSetPlayerCameraPos, METH_VARARGS, "" },
-	{ "SetPlayerChatBubble", sSetPlayerChatBubble, METH_VARARGS, "" },
-	{ "SetPlayerCheckpoint", sSetPlayerCheckpoint, METH_VARARGS, "" },
-	{ "SetPlayerColor", sSetPlayerColor, METH_VARARGS, "" },
-	{ "SetPlayerDrunkLevel", sSetPlayerDrunkLevel, METH_VARARGS, "" },
-	{ "SetPlayerFacingAngle", sSetPlayerFacingAngle, METH_VARARGS, "" },
-	{ "SetPlayerFightingStyle", sSetPlayerFightingStyle, METH_VARARGS, "" },
-	{ "SetPlayerHealth", sSetPlayerHealth, METH_VARARGS, "" },
-	{ "SetPlayerHoldingObject", sSetPlayerHoldingObject, METH_VARARGS, "" },
-	{ "SetPlayerInterior", sSetPlayerInterior, METH_VARARGS, "" },
-	{ "SetPlayerMapIcon", sSetPlayerMapIcon, METH_VARARGS, "" },
-	{ "SetPlayerMarkerForPlayer", sSetPlayerMarkerForPlayer, METH_VARARGS, "" },
-	{ "SetPlayerName", sSetPlayerName, METH_VARARGS, "" },
-	{ "SetPlayerObjectMaterial", sSetPlayerObjectMaterial, METH_VARARGS, "" },
-	{ "SetPlayerObjectMaterialText", sSetPlayerObjectMaterialText, METH_VARARGS, "" },
-	{ "SetPlayerObjectPos", sSetPlayerObjectPos, METH_VARARGS, "" },
-	{ "SetPlayerObjectRot", sSetPlayerObjectRot, METH_VARARGS, "" },
-	{ "SetPlayerPos", sSetPlayerPos, METH_VARARGS, "" },
-	{ "SetPlayerPosFindZ", sSetPlayerPosFindZ, METH_VARARGS, "" },
-	{ "SetPlayerRaceCheckpoint", sSetPlayerRaceCheckpoint, METH_VARARGS, "" },
-	{ "SetPlayerScore", sSetPlayerScore, METH_VARARGS, "" },
-	{ "SetPlayerShopName", sSetPlayerShopName, METH_VARARGS, "" },
-	{ "SetPlayerSkillLevel", sSetPlayerSkillLevel, METH_VARARGS, "" },
-	{ "SetPlayerSkin", sSetPlayerSkin, METH_VARARGS, "" },
-	{ "SetPlayerSpecialAction", sSetPlayerSpecialAction, METH_VARARGS, "" },
-	{ "SetPlayerTeam", sSetPlayerTeam, METH_VARARGS, "" },
-	{ "SetPlayerTime", sSetPlayerTime, METH_VARARGS, "" },
-	{ "SetPlayerVelocity", sSetPlayerVelocity, METH_VARARGS, "" },
-	{ "SetPlayerVirtualWorld", sSetPlayerVirtualWorld, METH_VARARGS, "" },
-	{ "SetPlayerWantedLevel", sSetPlayerWantedLevel, METH_VARARGS, "" },
-	{ "SetPlayerWeather", sSetPlayerWeather, METH_VARARGS, "" },
-	{ "SetPlayerWorldBounds", sSetPlayerWorldBounds, METH_VARARGS, "" },
-	{ "SetPVarFloat", sSetPVarFloat, METH_VARARGS, "" },
-	{ "SetPVarInt", sSetPVarInt, METH_VARARGS, "" },
-	{ "SetPVarString", sSetPVarString, METH_VARARGS, "" },
-	{ "SetSpawnInfo", sSetSpawnInfo, METH_VARARGS, "" },
-	{ "SetTeamCount", sSetTeamCount, METH_VARARGS, "" },
-	{ "SetTimer", sSetTimer, METH_VARARGS, "Sets a timer" },
-	{ "SetVehicleAngularVelocity", sSetVehicleAngularVelocity, METH_VARARGS, "" },
-	{ "SetVehicleHealth", sSetVehicleHealth, METH_VARARGS, "" },
-	{ "SetVehicleNumberPlate", sSetVehicleNumberPlate, METH_VARARGS, "" },
-	{ "SetVehicleParamsEx", sSetVehicleParamsEx, METH_VARARGS, "" },
-	{ "SetVehicleParamsForPlayer", sSetVehicleParamsForPlayer, METH_VARARGS, "" },
-	{ "SetVehiclePos", sSetVehiclePos, METH_VARARGS, "" },
-	{ "SetVehicleToRespawn", sSetVehicleToRespawn, METH_VARARGS, "" },
-	{ "SetVehicleVelocity", sSetVehicleVelocity, METH_VARARGS, "" },
-	{ "SetVehicleVirtualWorld", sSetVehicleVirtualWorld, METH_VARARGS, "" },
-	{ "SetVehicleZAngle", sSetVehicleZAngle, METH_VARARGS, "" },
-	{ "SetWeather", sSetWeather, METH_VARARGS, "" },
-	{ "SetWorldTime", sSetWorldTime, METH_VARARGS, "" },
-	{ "ShowMenuForPlayer", sShowMenuForPlayer, METH_VARARGS, "" },
-	{ "ShowNameTags", sShowNameTags, METH_VARARGS, "" },
-	{ "ShowPlayerDialog", sShowPlayerDialog, METH_VARARGS, "" },
-	{ "ShowPlayerMarkers", sShowPlayerMarkers, METH_VARARGS, "" },
-	{ "ShowPlayerNameTagForPlayer", sShowPlayerNameTagForPlayer, METH_VARARGS, "" },
-	{ "SpawnPlayer", sSpawnPlayer, METH_VARARGS, "" },
-	{ "StartRecordingPlayerData", sStartRecordingPlayerData, METH_VARARGS, "" },
-	{ "StopAudioStreamForPlayer", sStopAudioStreamForPlayer, METH_VARARGS, "" },
-	{ "StopObject", sStopObject, METH_VARARGS, "" },
-	{ "StopPlayerHoldingObject", sStopPlayerHoldingObject, METH_VARARGS, "" },
-	{ "StopPlayerObject", sStopPlayerObject, METH_VARARGS, "" },
-	{ "StopRecordingPlayerData", sStopRecordingPlayerData, METH_VARARGS, "" },
-
-	{ "TextDrawAlignment", sTextDrawAlignment, METH_VARARGS, "" },
-	{ "TextDrawBackgroundColor", sTextDrawBackgroundColor, METH_VARARGS, "" },
-	{ "TextDrawBoxColor", sTextDrawBoxColor, METH_VARARGS, "" },
-	{ "TextDrawColor", sTextDrawColor, METH_VARARGS, "" },
-	{ "TextDrawCreate", sTextDrawCreate, METH_VARARGS, "" },
-	{ "TextDrawDestroy", sTextDrawDestroy, METH_VARARGS, "" },
-	{ "TextDrawFont", sTextDrawFont, METH_VARARGS, "" },
-	{ "TextDrawHideForAll", sTextDrawHideForAll, METH_VARARGS, "" },
-	{ "TextDrawHideForPlayer", sTextDrawHideForPlayer, METH_VARARGS, "" },
-	{ "TextDrawLetterSize", sTextDrawLetterSize, METH_VARARGS, "" },
-	{ "TextDrawSetOutline", sTextDrawSetOutline, METH_VARARGS, "" },
-	{ "TextDrawSetProportional", sTextDrawSetProportional, METH_VARARGS, "" },
-	{ "TextDrawSetSelectable", sTextDrawSetSelectable, METH_VARARGS, "" },
-	{ "TextDrawSetShadow", sTextDrawSetShadow, METH_VARARGS, "" },
-	{ "TextDrawSetString", sTextDrawSetString, METH_VARARGS, "" },
-	{ "TextDrawSetPreviewModel", sTextDrawSetPreviewModel, METH_VARARGS, "" },
-	{ "TextDrawSetPreviewRot", sTextDrawSetPreviewRot, METH_VARARGS, "" },
-	{ "TextDrawSetPreviewVehCol", sTextDrawSetPreviewVehCol, METH_VARARGS, "" },
-	{ "TextDrawShowForAll", sTextDrawShowForAll, METH_VARARGS, "" },
-	{ "TextDrawShowForPlayer", sTextDrawShowForPlayer, METH_VARARGS, "" },
-	{ "TextDrawTextSize", sTextDrawTextSize, METH_VARARGS, "" },
-	{ "TextDrawUseBox", sTextDrawUseBox, METH_VARARGS, "" },
-	{ "TogglePlayerClock", sTogglePlayerClock, METH_VARARGS, "" },
-	{ "TogglePlayerControllable", sTogglePlayerControllable, METH_VARARGS, "" },
-	{ "TogglePlayerSpectating", sTogglePlayerSpectating, METH_VARARGS, "" },
-
-	{ "Update3DTextLabelText", sUpdate3DTextLabelText, METH_VARARGS, "" },
-	{ "UpdatePlayer3DTextLabelText", sUpdatePlayer3DTextLabelText, METH_VARARGS, "" },
-	{ "UpdateVehicleDamageStatus", sUpdateVehicleDamageStatus, METH_VARARGS, "" },
-	{ "UsePlayerPedAnims", sUsePlayerPedAnims, METH_VARARGS, "" },
+	{ "printf", (PyCFunction)sPrintf, METH_FASTCALL, "Prints to the log" },
+
+	{ "AddMenuItem", (PyCFunction)sAddMenuItem, METH_FASTCALL, "" },
+	{ "AddPlayerClass", (PyCFunction)sAddPlayerClass, METH_FASTCALL, "Adds a class to the class selection" },
+	{ "AddPlayerClassEx", (PyCFunction)sAddPlayerClassEx, METH_FASTCALL, "" },
+	{ "AddStaticPickup", (PyCFunction)sAddStaticPickup, METH_FASTCALL, "Adds a static pickup" },
+	{ "AddStaticVehicle", (PyCFunction)sAddStaticVehicle, METH_FASTCALL, "" },
+	{ "AddStaticVehicleEx", (PyCFunction)sAddStaticVehicleEx, METH_FASTCALL, "" },
+	{ "AddVehicleComponent", (PyCFunction)sAddVehicleComponent, METH_FASTCALL, "Adds a vehicle component" },
+	{ "AllowAdminTeleport", (PyCFunction)sAllowAdminTeleport, METH_FASTCALL, "" },
+	{ "AllowInteriorWeapons", (PyCFunction)sAllowInteriorWeapons, METH_FASTCALL, "Allows to use weapons in interiors" },
+	{ "AllowPlayerTeleport", (PyCFunction)sAllowPlayerTeleport, METH_FASTCALL, "" },
+	{ "ApplyAnimation", (PyCFunction)sApplyAnimation, METH_FASTCALL, "Applies an animation to a player" },
+	{ "Attach3DTextLabelToPlayer", (PyCFunction)sAttach3DTextLabelToPlayer, METH_FASTCALL, "" },
+	{ "Attach3DTextLabelToVehicle", (PyCFunction)sAttach3DTextLabelToVehicle, METH_FASTCALL, "" },
+	{ "AttachCameraToObject", (PyCFunction)sAttachCameraToObject, METH_FASTCALL, "" },
+	{ "AttachCameraToPlayerObject", (PyCFunction)sAttachCameraToPlayerObject, METH_FASTCALL, "" },
+	{ "AttachObjectToObject", (PyCFunction)sAttachObjectToObject, METH_FASTCALL, "" },
+	{ "AttachObjectToPlayer", (PyCFunction)sAttachObjectToPlayer, METH_FASTCALL, "" },
+	{ "AttachObjectToVehicle", (PyCFunction)sAttachObjectToVehicle, METH_FASTCALL, "" },
+	{ "AttachPlayerObjectToPlayer", (PyCFunction)sAttachPlayerObjectToPlayer, METH_FASTCALL, "" },
+	{ "AttachPlayerObjectToVehicle", (PyCFunction)sAttachPlayerObjectToVehicle, METH_FASTCALL, "" },
+	{ "AttachTrailerToVehicle", (PyCFunction)sAttachTrailerToVehicle, METH_FASTCALL, "" },
+
+	{ "Ban", (PyCFunction)sBan, METH_FASTCALL, "Bans a player" },
+	{ "BanEx", (PyCFunction)sBanEx, METH_FASTCALL, "Bans a player with a reason" },
+
+	{ "CallRemoteFunction", (PyCFunction)sCallRemoteFunction, METH_FASTCALL, "Call a public Pawn function by name" },
+	{ "CallNativeFunction", (PyCFunction)sCallNativeFunction, METH_FASTCALL, "Call a native Pawn function by name" },
+
+	{ "CancelEdit", (PyCFunction)sCancelEdit, METH_FASTCALL, "" },
+	{ "CancelSelectTextDraw", (PyCFunction)sCancelSelectTextDraw, METH_FASTCALL, "" },
+	{ "ChangeVehicleColor", (PyCFunction)sChangeVehicleColor, METH_FASTCALL, "Changes a vehicle's colors" },
+	{ "ChangeVehiclePaintjob", (PyCFunction)sChangeVehiclePaintjob, METH_FASTCALL, "Changes a vehicle's paintjob" },
+	{ "ClearAnimations", (PyCFunction)sClearAnimations, METH_FASTCALL, "Clears all animations for a player" },
+	{ "ConnectNPC", (PyCFunction)sConnectNPC, METH_FASTCALL, "Connects a NPC to the server" },
+	{ "Create3DTextLabel", (PyCFunction)sCreate3DTextLabel, METH_FASTCALL, "" },
+	{ "CreateExplosion", (PyCFunction)sCreateExplosion, METH_FASTCALL, "Creates an explosion" },
+	{ "CreateMenu", (PyCFunction)sCreateMenu, METH_FASTCALL, "" },
+	{ "CreateObject", (PyCFunction)sCreateObject, METH_FASTCALL, "Creates an object" },
+	{ "CreatePickup", (PyCFunction)sCreatePickup, METH_FASTCALL, "Creates a pickup" },
+	{ "CreatePlayer3DTextLabel", (PyCFunction)sCreatePlayer3DTextLabel, METH_FASTCALL, "" },
+	{ "CreatePlayerObject", (PyCFunction)sCreatePlayerObject, METH_FASTCALL, "Creates a player object" },
+	{ "CreateVehicle", (PyCFunction)sCreateVehicle, METH_FASTCALL, "Creates a vehicle" },
+
+	{ "Delete3DTextLabel", (PyCFunction)sDelete3DTextLabel, METH_FASTCALL, "Deletes a 3D text label" },
+	{ "DeletePlayer3DTextLabel", (PyCFunction)sDeletePlayer3DTextLabel, METH_FASTCALL, "Deletes a player 3D text label" },
+	{ "DeletePVar", (PyCFunction)sDeletePVar, METH_FASTCALL, "" },
+	{ "DestroyMenu", (PyCFunction)sDestroyMenu, METH_FASTCALL, "Destroys a menu" },
+	{ "DestroyObject", (PyCFunction)sDestroyObject, METH_FASTCALL, "Destroys an object" },
+	{ "DestroyPickup", (PyCFunction)sDestroyPickup, METH_FASTCALL, "Destroys a pickup" },
+	{ "DestroyPlayerObject", (PyCFunction)sDestroyPlayerObject, METH_FASTCALL, "Destroys a player object" },
+	{ "DestroyVehicle", (PyCFunction)sDestroyVehicle, METH_FASTCALL, "Destroys a vehicle" },
+	{ "DetachTrailerFromVehicle", (PyCFunction)sDetachTrailerFromVehicle, METH_FASTCALL, "Detaches a trailer from a vehicle" },
+	{ "DisableInteriorEnterExits", (PyCFunction)sDisableInteriorEnterExits, METH_FASTCALL, "Disables interior entrances" },
+	{ "DisableMenu", (PyCFunction)sDisableMenu, METH_FASTCALL, "Disables a menu" },
+	{ "DisableMenuRow", (PyCFunction)sDisableMenuRow, METH_FASTCALL, "Disables a menu row" },
+	{ "DisableNameTagLOS", (PyCFunction)sDisableNameTagLOS, METH_FASTCALL, "Disables name tag line of sight" },
+	{ "DisablePlayerCheckpoint", (PyCFunction)sDisablePlayerCheckpoint, METH_FASTCALL, "Disables a player's checkpoint" },
+	{ "DisablePlayerRaceCheckpoint", (PyCFunction)sDisablePlayerRaceCheckpoint, METH_FASTCALL, "Disables a player's race checkpoint" },
+
+	{ "EditObject", (PyCFunction)sEditObject, METH_FASTCALL, "" },
+	{ "EditPlayerObject", (PyCFunction)sEditPlayerObject, METH_FASTCALL, "" },
+	{ "EditAttachedObject", (PyCFunction)sEditAttachedObject, METH_FASTCALL, "" },
+	{ "EnableStuntBonusForAll", (PyCFunction)sEnableStuntBonusForAll, METH_FASTCALL, "Enables/disables stunt bonus for everyone" },
+	{ "EnableStuntBonusForPlayer", (PyCFunction)sEnableStuntBonusForPlayer, METH_FASTCALL, "Enables/disables stunt bonus for a player" },
+	{ "EnableVehicleFriendlyFire", (PyCFunction)sEnableVehicleFriendlyFire, METH_FASTCALL, "" },
+	{ "ForceClassSelection", (PyCFunction)sForceClassSelection, METH_FASTCALL, "Forces a player to the class selection after the next death" },
+
+	{ "GameModeExit", (PyCFunction)sGameModeExit, METH_FASTCALL, "Exits the current gamemode" },
+	{ "GameTextForAll", (PyCFunction)sGameTextForAll, METH_FASTCALL, "Sends a game text for everyone" },
+	{ "GameTextForPlayer", (PyCFunction)sGameTextForPlayer, METH_FASTCALL, "Sends a game text for a player" },
+	{ "GangZoneCreate", (PyCFunction)sGangZoneCreate, METH_FASTCALL, "Creates a gang zone" },
+	{ "GangZoneDestroy", (PyCFunction)sGangZoneDestroy, METH_FASTCALL, "Destroys a gang zone" },
+	{ "GangZoneFlashForAll", (PyCFunction)sGangZoneFlashForAll, METH_FASTCALL, "Flashes a gang zone for everyone" },
+	{ "GangZoneFlashForPlayer", (PyCFunction)sGangZoneFlashForPlayer, METH_FASTCALL, "Flashes a gang zone for a player" },
+	{ "GangZoneHideForAll", (PyCFunction)sGangZoneHideForAll, METH_FASTCALL, "Hides a gang zone for everyone" },
+	{ "GangZoneHideForPlayer", (PyCFunction)sGangZoneHideForPlayer, METH_FASTCALL, "Hides a gang zone for a player" },
+	{ "GangZoneShowForAll", (PyCFunction)sGangZoneShowForAll, METH_FASTCALL, "Shows a gang zone for everyone" },
+	{ "GangZoneShowForPlayer", (PyCFunction)sGangZoneShowForPlayer, METH_FASTCALL, "Shows a gang zone for a player" },
+	{ "GangZoneStopFlashForAll", (PyCFunction)sGangZoneStopFlashForAll, METH_FASTCALL, "Stops flashing a gang zone for everyone" },
+	{ "GangZoneStopFlashForPlayer", (PyCFunction)sGangZoneStopFlashForPlayer, METH_FASTCALL, "Stops flashing a gang zone for a player" },
+	{ "GetAnimationName", (PyCFunction)sGetAnimationName, METH_FASTCALL, "Returns the name of an animation" },
+	{ "GetMaxPlayers", (PyCFunction)sGetMaxPlayers, METH_FASTCALL, "Gets the max player value." },
+	{ "GetNetworkStats", (PyCFunction)sGetNetworkStats, METH_FASTCALL, "" },
+	{ "GetObjectPos", (PyCFunction)sGetObjectPos, METH_FASTCALL, "Gets an object's position" },
+	{ "GetObjectRot", (PyCFunction)sGetObjectRot, METH_FASTCALL, "Gets an object's rotation" },
+	{ "GetPlayerAmmo", (PyCFunction)sGetPlayerAmmo, METH_FASTCALL, "Gets a player's current amount of ammo" },
+	{ "GetPlayerAnimationIndex", (PyCFunction)sGetPlayerAnimationIndex, METH_FASTCALL, "Gets a player's animation index of an animation currently running" },
+	{ "GetPlayerArmour", (PyCFunction)sGetPlayerArmour, METH_FASTCALL, "Gets a player's armour" },
+	{ "GetPlayerCameraFrontVector", (PyCFunction)sGetPlayerCameraFrontVector, METH_FASTCALL, "Gets a relative position to the camera position of the player's aiming" },
+	{ "GetPlayerCameraMode", (PyCFunction)sGetPlayerCameraMode, METH_FASTCALL, "" },
+	{ "GetPlayerCameraPos", (PyCFunction)sGetPlayerCameraPos, METH_FASTCALL, "Gets the current camera position of a player" },
+	{ "GetPlayerColor", (PyCFunction)sGetPlayerColor, METH_FASTCALL, "Gets a player's color" },
+	{ "GetPlayerDistanceFromPoint", (PyCFunction)sGetPlayerDistanceFromPoint, METH_FASTCALL, "" },
+	{ "GetPlayerDrunkLevel", (PyCFunction)sGetPlayerDrunkLevel, METH_FASTCALL, "Gets a player's current drunk level" },
+	{ "GetPlayerFacingAngle", (PyCFunction)sGetPlayerFacingAngle, METH_FASTCALL, "Gets a player's current facing angle" },
+	{ "GetPlayerFightingStyle", (PyCFunction)sGetPlayerFightingStyle, METH_FASTCALL, "Gets a player's current fighting style" },
+	{ "GetPlayerHealth", (PyCFunction)sGetPlayerHealth, METH_FASTCALL, "Gets a player's current health" },
+	{ "GetPlayerInterior", (PyCFunction)sGetPlayerInterior, METH_FASTCALL, "Gets a player's current interior" },
+	{ "GetPlayerIp", (PyCFunction)sGetPlayerIp, METH_FASTCALL, "Gets a player's ip" },
+	{ "GetPlayerKeys", (PyCFunction)sGetPlayerKeys, METH_FASTCALL, "Gets keys currently pressed by a player" },
+	{ "GetPlayerMenu", (PyCFunction)sGetPlayerMenu, METH_FASTCALL, "Gets a player's current menu" },
+	{ "GetPlayerMoney", (PyCFunction)sGetPlayerMoney, METH_FASTCALL, "Gets a player's current amount of money" },
+	{ "GetPlayerName", (PyCFunction)sGetPlayerName, METH_FASTCALL, "Gets a player's name" },
+	{ "GetPlayerNetworkStats", (PyCFunction)sGetPlayerNetworkStats, METH_FASTCALL, "" },
+	{ "GetPlayerObjectPos", (PyCFunction)sGetPlayerObjectPos, METH_FASTCALL, "Gets a player object's position" },
+	{ "GetPlayerObjectRot", (PyCFunction)sGetPlayerObjectRot, METH_FASTCALL, "Gets a player object's rotation" },
+	{ "GetPlayerPing", (PyCFunction)sGetPlayerPing, METH_FASTCALL, "Gets a player's current ping" },
+	{ "GetPlayerPos", (PyCFunction)sGetPlayerPos, METH_FASTCALL, "Gets a player's position" },
+	{ "GetPlayerScore", (PyCFunction)sGetPlayerScore, METH_FASTCALL, "" },
+	{ "GetPlayerSkin", (PyCFunction)sGetPlayerSkin, METH_FASTCALL, "" },
+	{ "GetPlayerSpecialAction", (PyCFunction)sGetPlayerSpecialAction, METH_FASTCALL, "" },
+	{ "GetPlayerState", (PyCFunction)sGetPlayerState, METH_FASTCALL, "" },
+	{ "GetPlayerSurfingObjectID", (PyCFunction)sGetPlayerSurfingObjectID, METH_FASTCALL, "" },
+	{ "GetPlayerSurfingVehicleID", (PyCFunction)sGetPlayerSurfingVehicleID, METH_FASTCALL, "" },
+	{ "GetPlayerTargetPlayer", (PyCFunction)sGetPlayerTargetPlayer, METH_FASTCALL, "" },
+	{ "GetPlayerTeam", (PyCFunction)sGetPlayerTeam, METH_FASTCALL, "" },
+	{ "GetPlayerTime", (PyCFunction)sGetPlayerTime, METH_FASTCALL, "" },
+	{ "GetPlayerVehicleID", (PyCFunction)sGetPlayerVehicleID, METH_FASTCALL, "" },
+	{ "GetPlayerVehicleSeat", (PyCFunction)sGetPlayerVehicleSeat, METH_FASTCALL, "" },
+	{ "GetPlayerVelocity", (PyCFunction)sGetPlayerVelocity, METH_FASTCALL, "" },
+	{ "GetPlayerVersion", (PyCFunction)sGetPlayerVersion, METH_FASTCALL, "" },
+	{ "GetPlayerVirtualWorld", (PyCFunction)sGetPlayerVirtualWorld, METH_FASTCALL, "" },
+	{ "GetPlayerWantedLevel", (PyCFunction)sGetPlayerWantedLevel, METH_FASTCALL, "" },
+	{ "GetPlayerWeapon", (PyCFunction)sGetPlayerWeapon, METH_FASTCALL, "" },
+	{ "GetPlayerWeaponData", (PyCFunction)sGetPlayerWeaponData, METH_FASTCALL, "" },
+	{ "GetPlayerWeaponState", (PyCFunction)sGetPlayerWeaponState, METH_FASTCALL, "" },
+	{ "GetPVarFloat", (PyCFunction)sGetPVarFloat, METH_FASTCALL, "" },
+	{ "GetPVarInt", (PyCFunction)sGetPVarInt, METH_FASTCALL, "" },
+	{ "GetPVarString", (PyCFunction)sGetPVarString, METH_FASTCALL, "" },
+	{ "GetTickCount", (PyCFunction)sGetTickCount, METH_FASTCALL, "" },
+	{ "GetVehicleComponentInSlot", (PyCFunction)sGetVehicleComponentInSlot, METH_FASTCALL, "" },
+	{ "GetVehicleComponentType", (PyCFunction)sGetVehicleComponentType, METH_FASTCALL, "" },
+	{ "GetVehicleDamageStatus", (PyCFunction)sGetVehicleDamageStatus, METH_FASTCALL, "" },
+	{ "GetVehicleDistanceFromPoint", (PyCFunction)sGetVehicleDistanceFromPoint, METH_FASTCALL, "" },
+	{ "GetVehicleHealth", (PyCFunction)sGetVehicleHealth, METH_FASTCALL, "" },
+	{ "GetVehicleModel", (PyCFunction)sGetVehicleModel, METH_FASTCALL, "" },
+	{ "GetVehicleModelInfo", (PyCFunction)sGetVehicleModelInfo, METH_FASTCALL, "" },
+	{ "GetVehiclePos", (PyCFunction)sGetVehiclePos, METH_FASTCALL, "" },
+	{ "GetVehicleRotationQuat", (PyCFunction)sGetVehicleRotationQuat, METH_FASTCALL, "" },
+	{ "GetVehicleTrailer", (PyCFunction)sGetVehicleTrailer, METH_FASTCALL, "" },
+	{ "GetVehicleVelocity", (PyCFunction)sGetVehicleVelocity, METH_FASTCALL, "" },
+	{ "GetVehicleVirtualWorld", (PyCFunction)sGetVehicleVirtualWorld, METH_FASTCALL, "" },
+	{ "GetVehicleZAngle", (PyCFunction)sGetVehicleZAngle, METH_FASTCALL, "" },
+	{ "GetWeaponName", (PyCFunction)sGetWeaponName, METH_FASTCALL, "" },
+	{ "GivePlayerMoney", (PyCFunction)sGivePlayerMoney, METH_FASTCALL, "" },
+	{ "GivePlayerWeapon", (PyCFunction)sGivePlayerWeapon, METH_FASTCALL, "" },
+
+	{ "HideMenuForPlayer", (PyCFunction)sHideMenuForPlayer, METH_FASTCALL, "" },
+
+	{ "InterpolateCameraPos", (PyCFunction)sInterpolateCameraPos, METH_FASTCALL, "" },
+	{ "InterpolateCameraLookAt", (PyCFunction)sInterpolateCameraLookAt, METH_FASTCALL, "" },
+	{ "IsObjectMoving", (PyCFunction)sIsObjectMoving, METH_FASTCALL, "" },
+	{ "IsPlayerAdmin", (PyCFunction)sIsPlayerAdmin, METH_FASTCALL, "" },
+	{ "IsPlayerAttachedObjectSlotUsed", (PyCFunction)sIsPlayerAttachedObjectSlotUsed, METH_FASTCALL, "" },
+	{ "IsPlayerConnected", (PyCFunction)sIsPlayerConnected, METH_FASTCALL, "" },
+	{ "IsPlayerHoldingObject", (PyCFunction)sIsPlayerHoldingObject, METH_FASTCALL, "" },
+	{ "IsPlayerInAnyVehicle", (PyCFunction)sIsPlayerInAnyVehicle, METH_FASTCALL, "" },
+	{ "IsPlayerInCheckpoint", (PyCFunction)sIsPlayerInCheckpoint, METH_FASTCALL, "" },
+	{ "IsPlayerInRaceCheckpoint", (PyCFunction)sIsPlayerInRaceCheckpoint, METH_FASTCALL, "" },
+	{ "IsPlayerInRangeOfPoint", (PyCFunction)sIsPlayerInRangeOfPoint, METH_FASTCALL, "" },
+	{ "IsPlayerInVehicle", (PyCFunction)sIsPlayerInVehicle, METH_FASTCALL, "" },
+	{ "IsPlayerNPC", (PyCFunction)sIsPlayerNPC, METH_FASTCALL, "" },
+	{ "IsPlayerObjectMoving", (PyCFunction)sIsPlayerObjectMoving, METH_FASTCALL, "" },
+	{ "IsPlayerStreamedIn", (PyCFunction)sIsPlayerStreamedIn, METH_FASTCALL, "" },
+	{ "IsTrailerAttachedToVehicle", (PyCFunction)sIsTrailerAttachedToVehicle, METH_FASTCALL, "" },
+	{ "IsValidMenu", (PyCFunction)sIsValidMenu, METH_FASTCALL, "" },
+	{ "IsValidObject", (PyCFunction)sIsValidObject, METH_FASTCALL, "" },
+	{ "IsValidPlayerObject", (PyCFunction)sIsValidPlayerObject, METH_FASTCALL, "" },
+	{ "IsVehicleStreamedIn", (PyCFunction)sIsVehicleStreamedIn, METH_FASTCALL, "" },
+
+	{ "Kick", (PyCFunction)sKick, METH_FASTCALL, "Kick a specified player from the server" },
+	{ "KillTimer", (PyCFunction)sKillTimer, METH_FASTCALL, "Kills a timer" },
+
+	{ "LimitGlobalChatRadius", (PyCFunction)sLimitGlobalChatRadius, METH_FASTCALL, "" },
+	{ "LimitPlayerMarkerRadius", (PyCFunction)sLimitPlayerMarkerRadius, METH_FASTCALL, "" },
+	{ "LinkVehicleToInterior", (PyCFunction)sLinkVehicleToInterior, METH_FASTCALL, "" },
+
+	{ "ManualVehicleEngineAndLights", (PyCFunction)sManualVehicleEngineAndLights, METH_FASTCALL, "" },
+	{ "MoveObject", (PyCFunction)sMoveObject, METH_FASTCALL, "" },
+	{ "MovePlayerObject", (PyCFunction)sMovePlayerObject, METH_FASTCALL, "" },
+
+	{ "PlayAudioStreamForPlayer", (PyCFunction)sPlayAudioStreamForPlayer, METH_FASTCALL, "" },
+	{ "PlayCrimeReportForPlayer", (PyCFunction)sPlayCrimeReportForPlayer, METH_FASTCALL, "" },
+	{ "PlayerPlaySound", (PyCFunction)sPlayerPlaySound, METH_FASTCALL, "" },
+	{ "PlayerSpectatePlayer", (PyCFunction)sPlayerSpectatePlayer, METH_FASTCALL, "" },
+	{ "PlayerSpectateVehicle", (PyCFunction)sPlayerSpectateVehicle, METH_FASTCALL, "" },
+	{ "PutPlayerInVehicle", (PyCFunction)sPutPlayerInVehicle, METH_FASTCALL, "" },
+
+	{ "CreatePlayerTextDraw", (PyCFunction)sCreatePlayerTextDraw, METH_FASTCALL, "" },
+	{ "PlayerTextDrawDestroy", (PyCFunction)sPlayerTextDrawDestroy, METH_FASTCALL, "" },
+	{ "PlayerTextDrawLetterSize", (PyCFunction)sPlayerTextDrawLetterSize, METH_FASTCALL, "" },
+	{ "PlayerTextDrawTextSize", (PyCFunction)sPlayerTextDrawTextSize, METH_FASTCALL, "" },
+	{ "PlayerTextDrawAlignment", (PyCFunction)sPlayerTextDrawAlignment, METH_FASTCALL, "" },
+	{ "PlayerTextDrawColor", (PyCFunction)sPlayerTextDrawColor, METH_FASTCALL, "" },
+	{ "PlayerTextDrawUseBox", (PyCFunction)sPlayerTextDrawUseBox, METH_FASTCALL, "" },
+	{ "PlayerTextDrawBoxColor", (PyCFunction)sPlayerTextDrawBoxColor, METH_FASTCALL, "" },
+	{ "PlayerTextDrawSetShadow", (PyCFunction)sPlayerTextDrawSetShadow, METH_FASTCALL, "" },
+	{ "PlayerTextDrawSetOutline", (PyCFunction)sPlayerTextDrawSetOutline, METH_FASTCALL, "" },
+	{ "PlayerTextDrawBackgroundColor", (PyCFunction)sPlayerTextDrawBackgroundColor, METH_FASTCALL, "" },
+	{ "PlayerTextDrawFont", (PyCFunction)sPlayerTextDrawFont, METH_FASTCALL, "" },
+	{ "PlayerTextDrawSetProportional", (PyCFunction)sPlayerTextDrawSetProportional, METH_FASTCALL, "" },
+	{ "PlayerTextDrawSetSelectable", (PyCFunction)sPlayerTextDrawSetSelectable, METH_FASTCALL, "" },
+	{ "PlayerTextDrawSetPreviewModel", (PyCFunction)sPlayerTextDrawSetPreviewModel, METH_FASTCALL, "" },
+	{ "PlayerTextDrawSetPreviewRot", (PyCFunction)sPlayerTextDrawSetPreviewRot, METH_FASTCALL, "" },
+	{ "PlayerTextDrawSetPreviewVehCol", (PyCFunction)sPlayerTextDrawSetPreviewVehCol, METH_FASTCALL, "" },
+	{ "PlayerTextDrawShow", (PyCFunction)sPlayerTextDrawShow, METH_FASTCALL, "" },
+	{ "PlayerTextDrawHide", (PyCFunction)sPlayerTextDrawHide, METH_FASTCALL, "" },
+	{ "PlayerTextDrawSetString", (PyCFunction)sPlayerTextDrawSetString, METH_FASTCALL, "" },
+
+	{ "RemoveBuildingForPlayer", (PyCFunction)sRemoveBuildingForPlayer, METH_FASTCALL, "" },
+	{ "RemovePlayerAttachedObject", (PyCFunction)sRemovePlayerAttachedObject, METH_FASTCALL, "" },
+	{ "RemovePlayerFromVehicle", (PyCFunction)sRemovePlayerFromVehicle, METH_FASTCALL, "" },
+	{ "RemovePlayerMapIcon", (PyCFunction)sRemovePlayerMapIcon, METH_FASTCALL, "" },
+	{ "RemoveVehicleComponent", (PyCFunction)sRemoveVehicleComponent, METH_FASTCALL, "" },
+	{ "RepairVehicle", (PyCFunction)sRepairVehicle, METH_FASTCALL, "" },
+	{ "ResetPlayerMoney", (PyCFunction)sResetPlayerMoney, METH_FASTCALL, "" },
+	{ "ResetPlayerWeapons", (PyCFunction)sResetPlayerWeapons, METH_FASTCALL, "" },
+
+	{ "SelectObject", (PyCFunction)sSelectObject, METH_FASTCALL, "" },
+	{ "SelectTextDraw", (PyCFunction)sSelectTextDraw, METH_FASTCALL, "" },
+	{ "SendClientMessage", (PyCFunction)sSendClientMessage, METH_FASTCALL, "Sends a message to a player" },
+	{ "SendClientMessageToAll", (PyCFunction)sSendClientMessageToAll, METH_FASTCALL, "" },
+	{ "SendDeathMessage", (PyCFunction)sSendDeathMessage, METH_FASTCALL, "" },
+	{ "SendPlayerMessageToAll", (PyCFunction)sSendPlayerMessageToAll, METH_FASTCALL, "" },
+	{ "SendPlayerMessageToPlayer", (PyCFunction)sSendPlayerMessageToPlayer, METH_FASTCALL, "" },
+	{ "SendRconCommand", (PyCFunction)sSendRconCommand, METH_FASTCALL, "" },
+	{ "SetCameraBehindPlayer", (PyCFunction)sSetCameraBehindPlayer, METH_FASTCALL, "" },
+	{ "SetGameModeText", (PyCFunction)sSetGameModeText, METH_FASTCALL, "Sets the gamemode text" },
+	{ "SetGravity", (PyCFunction)sSetGravity, METH_FASTCALL, "Sets the gravity on the server" },
+	{ "SetMenuColumnHeader", (PyCFunction)sSetMenuColumnHeader, METH_FASTCALL, "" },
+	{ "SetNameTagDrawDistance", (PyCFunction)sSetNameTagDrawDistance, METH_FASTCALL, "" },
+	{ "SetObjectMaterial", (PyCFunction)sSetObjectMaterial, METH_FASTCALL, "" },
+	{ "SetObjectMaterialText", (PyCFunction)sSetObjectMaterialText, METH_FASTCALL, "" },
+	{ "SetObjectPos", (PyCFunction)sSetObjectPos, METH_FASTCALL, "" },
+	{ "SetObjectRot", (PyCFunction)sSetObjectRot, METH_FASTCALL, "" },
+	{ "SetPlayerAmmo", (PyCFunction)sSetPlayerAmmo, METH_FASTCALL, "" },
+	{ "SetPlayerArmedWeapon", (PyCFunction)sSetPlayerArmedWeapon, METH_FASTCALL, "" },
+	{ "SetPlayerArmour", (PyCFunction)sSetPlayerArmour, METH_FASTCALL, "" },
+	{ "SetPlayerAttachedObject", (PyCFunction)sSetPlayerAttachedObject, METH_FASTCALL, "" },
+	{ "SetPlayerCameraLookAt", (PyCFunction)sSetPlayerCameraLookAt, METH_FASTCALL, "" },
+	{ "SetPlayerCameraPos", (PyCFunction)sSetPlayerCameraPos, METH_FASTCALL, "" },
+	{ "SetPlayerChatBubble", (PyCFunction)sSetPlayerChatBubble, METH_FASTCALL, "" },
+	{ "SetPlayerCheckpoint", (PyCFunction)sSetPlayerCheckpoint, METH_FASTCALL, "" },
+	{ "SetPlayerColor", (PyCFunction)sSetPlayerColor, METH_FASTCALL, "" },
+	{ "SetPlayerDrunkLevel", (PyCFunction)sSetPlayerDrunkLevel, METH_FASTCALL, "" },
+	{ "SetPlayerFacingAngle", (PyCFunction)sSetPlayerFacingAngle, METH_FASTCALL, "" },
+	{ "SetPlayerFightingStyle", (PyCFunction)sSetPlayerFightingStyle, METH_FASTCALL, "" },
+	{ "SetPlayerHealth", (PyCFunction)sSetPlayerHealth, METH_FASTCALL, "" },
+	{ "SetPlayerHoldingObject", (PyCFunction)sSetPlayerHoldingObject, METH_FASTCALL, "" },
+	{ "SetPlayerInterior", (PyCFunction)sSetPlayerInterior, METH_FASTCALL, "" },
+	{ "SetPlayerMapIcon", (PyCFunction)sSetPlayerMapIcon, METH_FASTCALL, "" },
+	{ "SetPlayerMarkerForPlayer", (PyCFunction)sSetPlayerMarkerForPlayer, METH_FASTCALL, "" },
+	{ "SetPlayerName", (PyCFunction)sSetPlayerName, METH_FASTCALL, "" },
+	{ "SetPlayerObjectMaterial", (PyCFunction)sSetPlayerObjectMaterial, METH_FASTCALL, "" },
+	{ "SetPlayerObjectMaterialText", (PyCFunction)sSetPlayerObjectMaterialText, METH_FASTCALL, "" },
+	{ "SetPlayerObjectPos", (PyCFunction)sSetPlayerObjectPos, METH_FASTCALL, "" },
+	{ "SetPlayerObjectRot", (PyCFunction)sSetPlayerObjectRot, METH_FASTCALL, "" },
+	{ "SetPlayerPos", (PyCFunction)sSetPlayerPos, METH_FASTCALL, "" },
+	{ "SetPlayerPosFindZ", (PyCFunction)sSetPlayerPosFindZ, METH_FASTCALL, "" },
+	{ "SetPlayerRaceCheckpoint", (PyCFunction)sSetPlayerRaceCheckpoint, METH_FASTCALL, "" },
+	{ "SetPlayerScore", (PyCFunction)sSetPlayerScore, METH_FASTCALL, "" },
+	{ "SetPlayerShopName", (PyCFunction)sSetPlayerShopName, METH_FASTCALL, "" },
+	{ "SetPlayerSkillLevel", (PyCFunction)sSetPlayerSkillLevel, METH_FASTCALL, "" },
+	{ "SetPlayerSkin", (PyCFunction)sSetPlayerSkin, METH_FASTCALL, "" },
+	{ "SetPlayerSpecialAction", (PyCFunction)sSetPlayerSpecialAction, METH_FASTCALL, "" },
+	{ "SetPlayerTeam", (PyCFunction)sSetPlayerTeam, METH_FASTCALL, "" },
+	{ "SetPlayerTime", (PyCFunction)sSetPlayerTime, METH_FASTCALL, "" },
+	{ "SetPlayerVelocity", (PyCFunction)sSetPlayerVelocity, METH_FASTCALL, "" },
+	{ "SetPlayerVirtualWorld", (PyCFunction)sSetPlayerVirtualWorld, METH_FASTCALL, "" },
+	{ "SetPlayerWantedLevel", (PyCFunction)sSetPlayerWantedLevel, METH_FASTCALL, "" },
+	{ "SetPlayerWeather", (PyCFunction)sSetPlayerWeather, METH_FASTCALL, "" },
+	{ "SetPlayerWorldBounds", (PyCFunction)sSetPlayerWorldBounds, METH_FASTCALL, "" },
+	{ "SetPVarFloat", (PyCFunction)sSetPVarFloat, METH_FASTCALL, "" },
+	{ "SetPVarInt", (PyCFunction)sSetPVarInt, METH_FASTCALL, "" },
+	{ "SetPVarString", (PyCFunction)sSetPVarString, METH_FASTCALL, "" },
+	{ "SetSpawnInfo", (PyCFunction)sSetSpawnInfo, METH_FASTCALL, "" },
+	{ "SetTeamCount", (PyCFunction)sSetTeamCount, METH_FASTCALL, "" },
+	{ "SetTimer", (PyCFunction)sSetTimer, METH_FASTCALL, "Sets a timer" },
+	{ "SetVehicleAngularVelocity", (PyCFunction)sSetVehicleAngularVelocity, METH_FASTCALL, "" },
+	{ "SetVehicleHealth", (PyCFunction)sSetVehicleHealth, METH_FASTCALL, "" },
+	{ "SetVehicleNumberPlate", (PyCFunction)sSetVehicleNumberPlate, METH_FASTCALL, "" },
+	{ "SetVehicleParamsEx", (PyCFunction)sSetVehicleParamsEx, METH_FASTCALL, "" },
+	{ "SetVehicleParamsForPlayer", (PyCFunction)sSetVehicleParamsForPlayer, METH_FASTCALL, "" },
+	{ "SetVehiclePos", (PyCFunction)sSetVehiclePos, METH_FASTCALL, "" },
+	{ "SetVehicleToRespawn", (PyCFunction)sSetVehicleToRespawn, METH_FASTCALL, "" },
+	{ "SetVehicleVelocity", (PyCFunction)sSetVehicleVelocity, METH_FASTCALL, "" },
+	{ "SetVehicleVirtualWorld", (PyCFunction)sSetVehicleVirtualWorld, METH_FASTCALL, "" },
+	{ "SetVehicleZAngle", (PyCFunction)sSetVehicleZAngle, METH_FASTCALL, "" },
+	{ "SetWeather", (PyCFunction)sSetWeather, METH_FASTCALL, "" },
+	{ "SetWorldTime", (PyCFunction)sSetWorldTime, METH_FASTCALL, "" },
+	{ "ShowMenuForPlayer", (PyCFunction)sShowMenuForPlayer, METH_FASTCALL, "" },
+	{ "ShowNameTags", (PyCFunction)sShowNameTags, METH_FASTCALL, "" },
+	{ "ShowPlayerDialog", (PyCFunction)sShowPlayerDialog, METH_FASTCALL, "" },
+	{ "ShowPlayerMarkers", (PyCFunction)sShowPlayerMarkers, METH_FASTCALL, "" },
+	{ "ShowPlayerNameTagForPlayer", (PyCFunction)sShowPlayerNameTagForPlayer, METH_FASTCALL, "" },
+	{ "SpawnPlayer", (PyCFunction)sSpawnPlayer, METH_FASTCALL, "" },
+	{ "StartRecordingPlayerData", (PyCFunction)sStartRecordingPlayerData, METH_FASTCALL, "" },
+	{ "StopAudioStreamForPlayer", (PyCFunction)sStopAudioStreamForPlayer, METH_FASTCALL, "" },
+	{ "StopObject", (PyCFunction)sStopObject, METH_FASTCALL, "" },
+	{ "StopPlayerHoldingObject", (PyCFunction)sStopPlayerHoldingObject, METH_FASTCALL, "" },
+	{ "StopPlayerObject", (PyCFunction)sStopPlayerObject, METH_FASTCALL, "" },
+	{ "StopRecordingPlayerData", (PyCFunction)sStopRecordingPlayerData, METH_FASTCALL, "" },
+
+	{ "TextDrawAlignment", (PyCFunction)sTextDrawAlignment, METH_FASTCALL, "" },
+	{ "TextDrawBackgroundColor", (PyCFunction)sTextDrawBackgroundColor, METH_FASTCALL, "" },
+	{ "TextDrawBoxColor", (PyCFunction)sTextDrawBoxColor, METH_FASTCALL, "" },
+	{ "TextDrawColor", (PyCFunction)sTextDrawColor, METH_FASTCALL, "" },
+	{ "TextDrawCreate", (PyCFunction)sTextDrawCreate, METH_FASTCALL, "" },
+	{ "TextDrawDestroy", (PyCFunction)sTextDrawDestroy, METH_FASTCALL, "" },
+	{ "TextDrawFont", (PyCFunction)sTextDrawFont, METH_FASTCALL, "" },
+	{ "TextDrawHideForAll", (PyCFunction)sTextDrawHideForAll, METH_FASTCALL, "" },
+	{ "TextDrawHideForPlayer", (PyCFunction)sTextDrawHideForPlayer, METH_FASTCALL, "" },
+	{ "TextDrawLetterSize", (PyCFunction)sTextDrawLetterSize, METH_FASTCALL, "" },
+	{ "TextDrawSetOutline", (PyCFunction)sTextDrawSetOutline, METH_FASTCALL, "" },
+	{ "TextDrawSetProportional", (PyCFunction)sTextDrawSetProportional, METH_FASTCALL, "" },
+	{ "TextDrawSetSelectable", (PyCFunction)sTextDrawSetSelectable, METH_FASTCALL, "" },
+	{ "TextDrawSetShadow", (PyCFunction)sTextDrawSetShadow, METH_FASTCALL, "" },
+	{ "TextDrawSetString", (PyCFunction)sTextDrawSetString, METH_FASTCALL, "" },
+	{ "TextDrawSetPreviewModel", (PyCFunction)sTextDrawSetPreviewModel, METH_FASTCALL, "" },
+	{ "TextDrawSetPreviewRot", (PyCFunction)sTextDrawSetPreviewRot, METH_FASTCALL, "" },
+	{ "TextDrawSetPreviewVehCol", (PyCFunction)sTextDrawSetPreviewVehCol, METH_FASTCALL, "" },
+	{ "TextDrawShowForAll", (PyCFunction)sTextDrawShowForAll, METH_FASTCALL, "" },
+	{ "TextDrawShowForPlayer", (PyCFunction)sTextDrawShowForPlayer, METH_FASTCALL, "" },
+	{ "TextDrawTextSize", (PyCFunction)sTextDrawTextSize, METH_FASTCALL, "" },
+	{ "TextDrawUseBox", (PyCFunction)sTextDrawUseBox, METH_FASTCALL, "" },
+	{ "TogglePlayerClock", (PyCFunction)sTogglePlayerClock, METH_FASTCALL, "" },
+	{ "TogglePlayerControllable", (PyCFunction)sTogglePlayerControllable, METH_FASTCALL, "" },
+	{ "TogglePlayerSpectating", (PyCFunction)sTogglePlayerSpectating, METH_FASTCALL, "" },
+
+	{ "Update3DTextLabelText", (PyCFunction)sUpdate3DTextLabelText, METH_FASTCALL, "" },
+	{ "UpdatePlayer3DTextLabelText", (PyCFunction)sUpdatePlayer3DTextLabelText, METH_FASTCALL, "" },
+	{ "UpdateVehicleDamageStatus", (PyCFunction)sUpdateVehicleDamageStatus, METH_FASTCALL, "" },
+	{ "UsePlayerPedAnims", (PyCFunction)sUsePlayerPedAnims, METH_FASTCALL, "" },
 
 	// other functions
+	// connected players and bulk queries
+	{ "connected_players", (PyCFunction)sConnectedPlayers, METH_FASTCALL, "Returns the sorted ids of all connected players (npcs = None), humans (False) or NPCs (True)" },
+	{ "GetPlayersPos", (PyCFunction)sGetPlayersPos, METH_FASTCALL, "Returns the positions of many players as array('f', [x0, y0, z0, x1, ...])" },
+	{ "GetPlayersField", (PyCFunction)sGetPlayersField, METH_FASTCALL, "Returns one value (health, score, ...) of many players as an array" },
+	{ "SendClientMessageMany", (PyCFunction)sSendClientMessageMany, METH_FASTCALL, "Sends one message to all players of an iterable of ids" },
+	{ "SendClientMessageMask", (PyCFunction)sSendClientMessageMask, METH_FASTCALL, "Sends one message to all players set in a bitset (int or bytes-like)" },
+	{ "enable_snapshot", (PyCFunction)sEnableSnapshot, METH_FASTCALL, "Enables or disables the per-tick snapshot of all connected players" },
+	{ "snapshot", sSnapshot, METH_NOARGS, "Returns the players of the last snapshot as a dict of read-only memoryviews" },
+	// spatial index
+	{ "enable_spatial_index", (PyCFunction)sEnableSpatialIndex, METH_FASTCALL, "Enables or disables the per-tick grid of player (and vehicle) positions" },
+	{ "players_in_range", (PyCFunction)(void(*)(void))sPlayersInRange, METH_FASTCALL | METH_KEYWORDS, "Returns the ids of the players within range of a point as array('i')" },
+	{ "nearest_players", (PyCFunction)sNearestPlayers, METH_FASTCALL, "Returns the ids of the k players nearest to a player as array('i'), nearest first" },
+	{ "vehicles_in_range", (PyCFunction)(void(*)(void))sVehiclesInRange, METH_FASTCALL | METH_KEYWORDS, "Returns the ids of the vehicles within range of a point as array('i')" },
+	// textdraw shadow
+	{ "textdraw_batch", (PyCFunction)sTextDrawBatch, METH_FASTCALL, "Sets the strings of many textdraws, skipping the unchanged ones; returns how many were sent" },
+	{ "textdraw_invalidate", (PyCFunction)sTextDrawInvalidate, METH_FASTCALL, "Forgets the last values of textdraws changed from Pawn, so their next updates are sent" },
+	{ "textdraw_stats", sTextDrawStats, METH_NOARGS, "Returns how many textdraw updates were sent, dropped as unchanged and invalidated" },
+	// per-player data
+	{ "player_column", (PyCFunction)sPlayerColumn, METH_FASTCALL, "Returns a typed column of per-player data, optionally mirrored to a PVar" },
+	// compiled calls
+	{ "native", (PyCFunction)sNative, METH_FASTCALL, "Returns a callable for a native with a fixed argument format" },
+	{ "public", (PyCFunction)sPublic, METH_FASTCALL, "Returns a callable for a public with a fixed argument format" },
+	// native profiler
+	{ "profile_natives", (PyCFunction)sProfileNatives, METH_FASTCALL, "Enables or disables counting and timing native calls per calling module" },
+	{ "native_profile", sNativeProfile, METH_NOARGS, "Returns the native profile as (native, module, calls, total_us) tuples, most total time first" },
+	{ "dump_native_profile", (PyCFunction)sDumpNativeProfile, METH_FASTCALL, "Writes the native profile as a table to the log or to a file" },
+	{ "reset_native_profile", sResetNativeProfile, METH_NOARGS, "Clears the native profile" },
 	// multithreading
-	{ "InvokeFunction", sInvokeFunction, METH_VARARGS, "" },
+	{ "InvokeFunction", (PyCFunction)sInvokeFunction, METH_FASTCALL, "" },
+#if ENABLE_MULTITHREAD && ENABLE_GIL_STATS
+	{ "enable_gil_stats", (PyCFunction)sEnableGilStats, METH_FASTCALL, "Enables or disables the GIL wait and hold time histograms" },
+	{ "gil_stats", sGilStats, METH_NOARGS, "Returns GIL wait and hold time histograms per callback and per tick" },
+	{ "reset_gil_stats", sResetGilStats, METH_NOARGS, "Resets the GIL histograms" },
+#endif
+#if ENABLE_MULTITHREAD
+	{ "set_gil_priority", (PyCFunction)sSetGilPriority, METH_FASTCALL, "Lets the server thread take the GIL before background threads" },
+	{ "start_thread", (PyCFunction)sStartThread, METH_FASTCALL, "Starts a background thread which yields to the server thread" },
+#endif
 
 	{ NULL, NULL, 0, NULL }
 };
@@ -372,6 +415,11 @@ PyMethodDef _pySampMethods[] =
 struct module_state
 {
         PyObject *error;
+        PyTypeObject *vec3;
+        PyTypeObject *quat;
+        PyTypeObject *compiled;
+        PyTypeObject *out;
+        PyTypeObject *columns;
 };
 
 #if PY_MAJOR_VERSION >= 3
@@ -386,15 +434,230 @@ struct module_state
 static int _pyModuleTraverse(PyObject *m, visitproc visit, void *arg)
 {
         Py_VISIT(GETSTATE(m)->error);
+        Py_VISIT(GETSTATE(m)->vec3);
+        Py_VISIT(GETSTATE(m)->quat);
+        Py_VISIT(GETSTATE(m)->compiled);
+        Py_VISIT(GETSTATE(m)->out);
+        Py_VISIT(GETSTATE(m)->columns);
         return 0;
 }
 
 static int _pyModuleClear(PyObject *m)
 {
         Py_CLEAR(GETSTATE(m)->error);
+        Py_CLEAR(GETSTATE(m)->vec3);
+        Py_CLEAR(GETSTATE(m)->quat);
+        Py_CLEAR(GETSTATE(m)->compiled);
+        Py_CLEAR(GETSTATE(m)->out);
+        Py_CLEAR(GETSTATE(m)->columns);
         return 0;
 }
 
+// ----------------------------------
+// Vec3 and Quat
+// ----------------------------------
+
+static PyStructSequence_Field _pyVec3Fields[] =
+{
+	{ "x", NULL }, { "y", NULL }, { "z", NULL },
+	{ NULL, NULL }
+};
+static PyStructSequence_Desc _pyVec3Desc = { "samp.Vec3", "Position, rotation or velocity (x, y, z)", _pyVec3Fields, 3 };
+
+static PyStructSequence_Field _pyQuatFields[] =
+{
+	{ "w", NULL }, { "x", NULL }, { "y", NULL }, { "z", NULL },
+	{ NULL, NULL }
+};
+static PyStructSequence_Desc _pyQuatDesc = { "samp.Quat", "Rotation quaternion (w, x, y, z)", _pyQuatFields, 4 };
+
+// v['x'] still works like it did when the getters returned dicts; v[0] and slices work like on tuples
+static PyObject *_pyStructSubscript(PyObject *self, PyObject *key)
+{
+	if (!PyUnicode_Check(key))
+		return PyTuple_Type.tp_as_mapping->mp_subscript(self, key);
+
+	PyMemberDef *member = Py_TYPE(self)->tp_members;
+	for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(self) && member[i].name != NULL; i++)
+	{
+		if (PyUnicode_CompareWithASCIIString(key, member[i].name) == 0)
+		{
+			PyObject *v = PyTuple_GET_ITEM(self, i);
+			Py_INCREF(v);
+			return v;
+		}
+	}
+	PyErr_SetObject(PyExc_KeyError, key);
+	return NULL;
+}
+
+static PyTypeObject *_pyNewStructType(PyObject *m, PyStructSequence_Desc *desc)
+{
+	PyTypeObject *type = PyStructSequence_NewType(desc);
+	if (type == NULL)
+		return NULL;
+
+	// heap types have their own copy of the mapping slots
+	type->tp_as_mapping->mp_subscript = _pyStructSubscript;
+	PyType_Modified(type);
+
+	// the module keeps its own reference in the state
+	Py_INCREF(type);
+	if (PyModule_AddObject(m, strchr(desc->name, '.') + 1, (PyObject *)type) == -1)
+	{
+		Py_DECREF(type);
+		Py_DECREF(type);
+		return NULL;
+	}
+	return type;
+}
+
+PyTypeObject *_pyVec3Type(PyObject *module)
+{
+	return GETSTATE(module)->vec3;
+}
+PyTypeObject *_pyQuatType(PyObject *module)
+{
+	return GETSTATE(module)->quat;
+}
+PyTypeObject *_pyCompiledType(PyObject *module)
+{
+	return GETSTATE(module)->compiled;
+}
+PyTypeObject *_pyPlayerColumnType(PyObject *module)
+{
+	return GETSTATE(module)->columns;
+}
+
+// ----------------------------------
+// Out: placeholder for out params of CallNativeFunction
+// ----------------------------------
+
+struct py_out
+{
+	PyObject_HEAD
+	char kind;	// 'i', 'f' or 's'
+	int size;	// cells of a string
+};
+
+// Out(int), Out(float) or Out(str, size)
+static PyObject *_pyOutNew(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+	PyObject *kind;
+	int size = 0;
+	if (!PyArg_ParseTuple(args, "O|i:Out", &kind, &size))
+		return NULL;
+
+	char k;
+	if (kind == (PyObject *)&PyLong_Type)
+		k = 'i';
+	else if (kind == (PyObject *)&PyFloat_Type)
+		k = 'f';
+	else if (kind == (PyObject *)&PyUnicode_Type)
+		k = 's';
+	else
+	{
+		PyErr_SetString(PyExc_TypeError, "Out() takes int, float or str");
+		return NULL;
+	}
+	if ((k == 's') != (size > 0))
+	{
+		PyErr_SetString(PyExc_ValueError, k == 's' ? "Out(str) needs a size" : "only Out(str) takes a size");
+		return NULL;
+	}
+
+	py_out *self = (py_out *)type->tp_alloc(type, 0);
+	if (self == NULL)
+		return NULL;
+	self->kind = k;
+	self->size = k == 's' ? size : 1;
+	return (PyObject *)self;
+}
+
+static PyObject *_pyOutRepr(PyObject *o)
+{
+	py_out *self = (py_out *)o;
+	if (self->kind == 's')
+		return PyUnicode_FromFormat("samp.Out(str, %d)", self->size);
+	return PyUnicode_FromString(self->kind == 'i' ? "samp.Out(int)" : "samp.Out(float)");
+}
+
+static void _pyOutDealloc(PyObject *o)
+{
+	PyTypeObject *type = Py_TYPE(o);
+	type->tp_free(o);
+	Py_DECREF(type);
+}
+
+static PyType_Slot _pyOutSlots[] =
+{
+	{ Py_tp_new, (void *)_pyOutNew },
+	{ Py_tp_repr, (void *)_pyOutRepr },
+	{ Py_tp_dealloc, (void *)_pyOutDealloc },
+	{ Py_tp_doc, (void *)"Out(int), Out(float) or Out(str, size): out param of CallNativeFunction" },
+	{ 0, NULL }
+};
+
+static PyType_Spec _pyOutSpec = { "samp.Out", sizeof(py_out), 0, Py_TPFLAGS_DEFAULT, _pyOutSlots };
+
+static PyTypeObject *_pyNewOutType(PyObject *m)
+{
+	PyTypeObject *type = (PyTypeObject *)PyType_FromModuleAndSpec(m, &_pyOutSpec, NULL);
+	if (type == NULL)
+		return NULL;
+
+	// the module keeps its own reference in the state
+	Py_INCREF(type);
+	if (PyModule_AddObject(m, "Out", (PyObject *)type) == -1)
+	{
+		Py_DECREF(type);
+		Py_DECREF(type);
+		return NULL;
+	}
+	return type;
+}
+
+// kind and cells of a samp.Out of this module, false for anything else
+bool _pyOutParam(PyObject *module, PyObject *o, char *kind, int *size)
+{
+	if (Py_TYPE(o) != GETSTATE(module)->out)
+		return false;
+	*kind = ((py_out *)o)->kind;
+	*size = ((py_out *)o)->size;
+	return true;
+}
+
+static int _pyModuleExec(PyObject *m)
+{
+        _pyInitMacros(m);
+        if (PyErr_Occurred())
+                return -1;
+
+        GETSTATE(m)->vec3 = _pyNewStructType(m, &_pyVec3Desc);
+        if (!PyErr_Occurred())
+                GETSTATE(m)->quat = _pyNewStructType(m, &_pyQuatDesc);
+        if (!PyErr_Occurred())
+                GETSTATE(m)->compiled = _compiledNewType(m);
+        if (!PyErr_Occurred())
+                GETSTATE(m)->out = _pyNewOutType(m);
+        if (!PyErr_Occurred())
+                GETSTATE(m)->columns = _playerColumnNewType(m);
+        return PyErr_Occurred() ? -1 : 0;
+}
+
+// multi-phase init, so every (sub)interpreter gets its own samp module
+static PyModuleDef_Slot pysamp_slots[] =
+{
+        { Py_mod_exec, (void *)_pyModuleExec },
+#if PY_VERSION_HEX >= 0x030C0000
+        { Py_mod_multiple_interpreters, Py_MOD_PER_INTERPRETER_GIL_SUPPORTED },
+#endif
+#ifdef Py_GIL_DISABLED
+        // or importing samp would turn the GIL back on
+        { Py_mod_gil, Py_MOD_GIL_NOT_USED },
+#endif
+        { 0, NULL }
+};
 
 static struct PyModuleDef pysamp_moduledef =
 {
@@ -403,7 +666,7 @@ static struct PyModuleDef pysamp_moduledef =
         NULL,
         sizeof(struct module_state),
         _pySampMethods,
-        NULL,
+        pysamp_slots,
         _pyModuleTraverse,
         _pyModuleClear,
         NULL
@@ -412,9 +675,335 @@ static struct PyModuleDef pysamp_moduledef =
 
 
 
-std::deque<PyObject *> m_pyModule;
+std::deque<py_module> m_pyModule;
 bool m_pyInited = false;
+Event m_pyReady; // set by _pyMainThread once Python is initialized
+PyThreadState *m_pyMainState = NULL; // thread state of the server thread in threading single mode
+
+// ----------------------------------
+// subinterpreters
+// ----------------------------------
+
+bool _pyIsMainInterp()
+{
+#if ENABLE_SUBINTERPRETERS
+	return PyInterpreterState_Get() == PyInterpreterState_Main();
+#else
+	return true;
+#endif
+}
+
+PyInterpreterState *_pyCurrentInterp()
+{
+#if ENABLE_SUBINTERPRETERS
+	return PyInterpreterState_Get();
+#else
+	return NULL;
+#endif
+}
+
+// switches the server thread from the main interpreter to the given one;
+// returns the thread state to pass to _pyLeaveInterp, or NULL if nothing had to be done
+PyThreadState *_pyEnterInterp(PyInterpreterState *interp)
+{
+#if ENABLE_SUBINTERPRETERS
+	if (interp == NULL || interp == PyInterpreterState_Main())
+		return NULL;
+
+	for (std::deque<py_module>::iterator i = m_pyModule.begin(); i != m_pyModule.end(); i++)
+	{
+		if (i->tstate != NULL && PyThreadState_GetInterpreter(i->tstate) == interp)
+		{
+			PyThreadState *prev = PyEval_SaveThread();
+			PyEval_RestoreThread(i->tstate);
+			return prev;
+		}
+	}
+#endif
+	return NULL;
+}
+void _pyLeaveInterp(PyThreadState *prev)
+{
+#if ENABLE_SUBINTERPRETERS
+	if (prev == NULL) return;
+
+	PyEval_SaveThread();
+	PyEval_RestoreThread(prev);
+#endif
+}
+
+#if ENABLE_SUBINTERPRETERS
+// callback arguments are built in the main interpreter and have to be rebuilt in the target one
+struct py_value
+{
+	char type;
+	long long i;
+	double f;
+	std::string s;
+};
+
+// false if an argument can't be passed on: either logged here, or with a Python error set
+static bool _pyArgsExport(PyObject *args, std::vector<py_value> &values)
+{
+	if (args == NULL) return true;
+
+	Py_ssize_t count = PyTuple_Size(args);
+	values.resize(count);
+	for (Py_ssize_t n = 0; n < count; n++)
+	{
+		PyObject *o = PyTuple_GET_ITEM(args, n);
+		py_value &v = values[n];
+		if (o == Py_None)
+			v.type = 'n';
+		else if (PyBool_Check(o))
+		{
+			v.type = 'b';
+			v.i = (o == Py_True);
+		}
+		else if (PyLong_Check(o))
+		{
+			v.type = 'i';
+			v.i = PyLong_AsLongLong(o);
+			if (v.i == -1 && PyErr_Occurred()) return false;
+		}
+		else if (PyFloat_Check(o))
+		{
+			v.type = 'f';
+			v.f = PyFloat_AS_DOUBLE(o);
+		}
+		else if (PyUnicode_Check(o))
+		{
+			Py_ssize_t len;
+			const char *str = PyUnicode_AsUTF8AndSize(o, &len);
+			if (str == NULL) return false;
+			v.type = 's';
+			v.s.assign(str, len);
+		}
+		else
+		{
+			logprintf("PYTHON: Can't pass %s to another interpreter", Py_TYPE(o)->tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+static PyObject *_pyArgsImport(std::vector<py_value> &values)
+{
+	PyObject *args = PyTuple_New(values.size());
+	if (args == NULL) return NULL;
+
+	for (size_t n = 0; n < values.size(); n++)
+	{
+		py_value &v = values[n];
+		PyObject *o;
+		switch (v.type)
+		{
+		case 'b': o = PyBool_FromLong((long)v.i); break;
+		case 'i': o = PyLong_FromLongLong(v.i); break;
+		case 'f': o = PyFloat_FromDouble(v.f); break;
+		case 's': o = PyUnicode_FromStringAndSize(v.s.data(), v.s.size()); break;
+		default: o = Py_None; Py_INCREF(o); break;
+		}
+		if (o == NULL)
+		{
+			Py_DECREF(args);
+			return NULL;
+		}
+		PyTuple_SET_ITEM(args, n, o);
+	}
+	return args;
+}
 
+#endif
+
+static int _pyParseCountError(Py_ssize_t min, Py_ssize_t max, Py_ssize_t nargs)
+{
+	PyErr_Format(PyExc_TypeError, "function takes %s %zd argument%s (%zd given)",
+		min == max ? "exactly" : (nargs < min ? "at least" : "at most"),
+		nargs < min ? min : max,
+		(nargs < min ? min : max) == 1 ? "" : "s",
+		nargs);
+	return 0;
+}
+
+// PyArg_ParseTuple for METH_FASTCALL functions, reading the argument vector directly;
+// supports the codes the samp module uses: i l I b p f d s O O! O& and |
+int _pyParseFast(PyObject *const *args, Py_ssize_t nargs, const char *format, ...)
+{
+	Py_ssize_t min = -1, max = 0;
+	for(const char *f = format; *f; ++f)
+	{
+		if(*f == '|')
+			min = max;
+		else if(*f != '!' && *f != '&')
+			max++;
+	}
+	if(min == -1)
+		min = max;
+
+	if(nargs < min || nargs > max)
+		return _pyParseCountError(min, max, nargs);
+
+	va_list va;
+	va_start(va, format);
+
+	Py_ssize_t i = 0;
+	for(const char *f = format; *f && i < nargs; ++f)
+	{
+		PyObject *arg = args[i];
+		switch(*f)
+		{
+		case '|':
+			continue;
+		case 'i':
+		case 'l':
+		{
+			long v = PyLong_AsLong(arg);
+			if(v == -1 && PyErr_Occurred())
+				goto error;
+			if(*f == 'l')
+				*va_arg(va, long *) = v;
+			else if(v < INT_MIN || v > INT_MAX)
+			{
+				PyErr_SetString(PyExc_OverflowError, "signed integer is out of range");
+				goto error;
+			}
+			else
+				*va_arg(va, int *) = (int)v;
+			break;
+		}
+		case 'I':
+		{
+			if(!PyLong_Check(arg))
+			{
+				PyErr_Format(PyExc_TypeError, "an integer is required (got type %.200s)", Py_TYPE(arg)->tp_name);
+				goto error;
+			}
+			*va_arg(va, unsigned int *) = (unsigned int)PyLong_AsUnsignedLongMask(arg);
+			break;
+		}
+		case 'b':
+		{
+			long v = PyLong_AsLong(arg);
+			if(v == -1 && PyErr_Occurred())
+				goto error;
+			if(v < 0 || v > UCHAR_MAX)
+			{
+				PyErr_SetString(PyExc_OverflowError, "unsigned byte integer is out of range");
+				goto error;
+			}
+			*va_arg(va, unsigned char *) = (unsigned char)v;
+			break;
+		}
+		case 'p':
+		{
+			int v = PyObject_IsTrue(arg);
+			if(v == -1)
+				goto error;
+			*va_arg(va, int *) = v;
+			break;
+		}
+		case 'f':
+		case 'd':
+		{
+			double v = PyFloat_AsDouble(arg);
+			if(v == -1.0 && PyErr_Occurred())
+				goto error;
+			if(*f == 'f')
+				*va_arg(va, float *) = (float)v;
+			else
+				*va_arg(va, double *) = v;
+			break;
+		}
+		case 's':
+		{
+			Py_ssize_t len;
+			const char *v = PyUnicode_Check(arg) ? PyUnicode_AsUTF8AndSize(arg, &len) : NULL;
+			if(v == NULL)
+			{
+				if(!PyErr_Occurred())
+					PyErr_Format(PyExc_TypeError, "argument %zd must be str, not %.200s", i + 1, Py_TYPE(arg)->tp_name);
+				goto error;
+			}
+			if((size_t)len != strlen(v))
+			{
+				PyErr_SetString(PyExc_ValueError, "embedded null character");
+				goto error;
+			}
+			*va_arg(va, const char **) = v;
+			break;
+		}
+		case 'O':
+			if(f[1] == '!')
+			{
+				PyTypeObject *type = va_arg(va, PyTypeObject *);
+				if(!PyObject_TypeCheck(arg, type))
+				{
+					PyErr_Format(PyExc_TypeError, "argument %zd must be %.50s, not %.50s", i + 1, type->tp_name, Py_TYPE(arg)->tp_name);
+					goto error;
+				}
+				++f;
+			}
+			else if(f[1] == '&')
+			{
+				typedef int (*converter)(PyObject *, void *);
+				converter conv = va_arg(va, converter);
+				if(!conv(arg, va_arg(va, void *)))
+					goto error;
+				++f;
+				break;
+			}
+			*va_arg(va, PyObject **) = arg;
+			break;
+		default:
+			PyErr_Format(PyExc_SystemError, "bad format char '%c' passed to _pyParseFast", *f);
+			goto error;
+		}
+		++i;
+	}
+
+	va_end(va);
+	return 1;
+
+error:
+	va_end(va);
+	return 0;
+}
+
+// array.array(typecode) holding a copy of size bytes of data
+PyObject *_pyNewArray(const char *typecode, const void *data, Py_ssize_t size)
+{
+	PyObject *array = PyImport_ImportModule("array");
+	if (array == NULL)
+		return NULL;
+
+	PyObject *bytes = PyBytes_FromStringAndSize((const char *)data, size);
+	PyObject *ret = NULL;
+	if (bytes != NULL)
+		ret = PyObject_CallMethod(array, "array", "sO", typecode, bytes);
+
+	Py_XDECREF(bytes);
+	Py_DECREF(array);
+	return ret;
+}
+
+// read-only 1-dimensional memoryview of count items of C memory, without copying;
+// format has to be a static string ("f", "i", ...) since the view keeps pointing to it
+PyObject *_pyNewView(void *data, Py_ssize_t count, const char *format, Py_ssize_t itemsize)
+{
+	Py_ssize_t shape[1] = { count }, strides[1] = { itemsize };
+	Py_buffer view;
+	memset(&view, 0, sizeof(view));
+	view.buf = data;
+	view.len = count * itemsize;
+	view.readonly = 1;
+	view.itemsize = itemsize;
+	view.format = (char *)format;
+	view.ndim = 1;
+	view.shape = shape;		// copied by the memoryview
+	view.strides = strides;
+	return PyMemoryView_FromBuffer(&view);
+}
 
 char *_pyGetString(PyObject *obj)
 {
@@ -464,13 +1053,23 @@ void _pyLogError()
 			{
 				while (tb != NULL)
 				{
-					char *fname = _pyGetString(tb->tb_frame->f_code->co_filename), *name = _pyGetString(tb->tb_frame->f_code->co_name), *cline;
+#if PY_VERSION_HEX >= 0x030B0000
+					// frame internals are private since 3.11
+					PyCodeObject *code = PyFrame_GetCode(tb->tb_frame);
+					PyObject *globals = PyFrame_GetGlobals(tb->tb_frame);
+#else
+					PyCodeObject *code = tb->tb_frame->f_code;
+					PyObject *globals = tb->tb_frame->f_globals;
+					Py_INCREF(code); Py_INCREF(globals);
+#endif
+					char *fname = _pyGetString(code->co_filename), *name = _pyGetString(code->co_name), *cline;
 					logprintf("    %s[%d] in %s", fname, tb->tb_lineno, name);
 					// use getline to get the code line
-					PyObject *codeline = PyObject_CallFunction(lc_getline, "OiO", tb->tb_frame->f_code->co_filename, tb->tb_lineno, tb->tb_frame->f_globals);
+					PyObject *codeline = PyObject_CallFunction(lc_getline, "OiO", code->co_filename, tb->tb_lineno, globals);
 					cline = _pyGetString(codeline);
 					logprintf("      %s", cline);
-					Py_DECREF(codeline);
+					Py_XDECREF(codeline);
+					Py_DECREF(code); Py_DECREF(globals);
 					free(fname); free(name); free(cline);
 					tb = tb->tb_next;
 				}
@@ -508,19 +1107,67 @@ PyObject *_pyCallFunc(PyObject *module, const char *funcname, PyObject *args)
 
 	return ret;
 }
+// checks if a callback returned the given int (or bool)
+static bool _pyIsReturnValue(PyObject *r, int value)
+{
+	if (r == NULL || !PyLong_Check(r)) return false;
+
+	long v = PyLong_AsLong(r);
+	if (v == -1 && PyErr_Occurred())
+	{
+		PyErr_Clear();
+		return false;
+	}
+	return v == value;
+}
 cell _pyCallAll(const char *funcname, PyObject *args, int nondefval, int defval)
 {
-	PyObject *val = PyLong_FromLong(nondefval); // if one module returns this value, return this
-	PyObject *boolval = PyBool_FromLong(nondefval);
-	bool ret_val = false;
-	for (std::deque<PyObject*>::iterator i = m_pyModule.begin(); i != m_pyModule.end(); i++)
+	bool ret_val = false; // if one module returns nondefval, return this
+#if ENABLE_SUBINTERPRETERS
+	std::vector<py_value> shared;
+	bool exported = false;
+#endif
+	for (std::deque<py_module>::iterator i = m_pyModule.begin(); i != m_pyModule.end(); i++)
 	{
-		PyObject *r = _pyCallFunc(*i, funcname, args);
+#if ENABLE_SUBINTERPRETERS
+		if (i->tstate != NULL)
+		{
+			// module lives in its own interpreter
+			if (!exported)
+			{
+				if (!_pyArgsExport(args, shared))
+				{
+					// an int too large for 64 bits, or a str with lone surrogates
+					if (PyErr_Occurred()) PyErr_Print();
+					continue;
+				}
+				exported = true;
+			}
+
+			PyThreadState *mainstate = PyEval_SaveThread();
+			PyEval_RestoreThread(i->tstate);
+
+			PyObject *subargs = _pyArgsImport(shared);
+			if (subargs != NULL)
+			{
+				PyObject *r = _pyCallFunc(i->module, funcname, subargs);
+				PyErr_Clear();
+				if (_pyIsReturnValue(r, nondefval)) ret_val = true;
+				Py_XDECREF(r);
+				Py_DECREF(subargs);
+			}
+			PyErr_Clear();
+
+			PyEval_SaveThread();
+			PyEval_RestoreThread(mainstate);
+			continue;
+		}
+#endif
+		PyObject *r = _pyCallFunc(i->module, funcname, args);
 		PyErr_Clear(); // this can be set by PyObject_GetAttrString in _pyCallFunc, but we want to ignore it
-		if (r == val || r == boolval) ret_val = true;
+		if (_pyIsReturnValue(r, nondefval)) ret_val = true;
 		Py_XDECREF(r);
 	}
-	Py_DECREF(val); Py_DECREF(boolval);
 	// DEBUG
 	/*if (funcname[8] != 'U') // avoid OnPlayerUpdate
 		logprintf("PYTHON: callback %s return value %d", funcname, (ret_val ? nondefval : defval));*/
@@ -531,21 +1178,13 @@ cell _pyCallAll(const char *funcname, PyObject *args, int nondefval, int defval)
 #if PY_MAJOR_VERSION >= 3
 PyMODINIT_FUNC PyInit_samp()
 {
-	PyObject *samp_mod = PyModule_Create(&pysamp_moduledef);
-	_pyInitMacros(samp_mod);
-	return samp_mod;
+	return PyModuleDef_Init(&pysamp_moduledef);
 }
 #endif
 
-#if ENABLE_MULTITHREAD
-	THREAD_RETURN _pyInit(void *prm)
-#else
-	void _pyInit()
-#endif
+// initializes Python on the calling thread, which keeps holding the GIL
+void _pyInit()
 {
-	// prevent other thread to continue until Python is completely initialized
-	m_MainLock->Lock();
-
 #if PY_MAJOR_VERSION >= 3
 	PyImport_AppendInittab("samp", PyInit_samp);
 #endif
@@ -560,18 +1199,89 @@ PyMODINIT_FUNC PyInit_samp()
 #endif
 
 	PyRun_SimpleString("import sys; sys.path.append('.'); del sys");
+}
 
-	m_MainLock->Unlock();
 #if ENABLE_MULTITHREAD
-	// run a main loop; this thread still holds the GIL
-	// this creates a new event in the samp module and waits for it to be set
-	PyRun_SimpleString("import threading, samp\nsamp.exit_listener = threading.Event()\nsamp.exit_listener.wait()");
+// Python's main thread in threading multi mode: initializes Python, sets m_pyReady
+// and runs until UnloadPython sets samp.exit_listener
+THREAD_RETURN _pyMainThread(void *prm)
+{
+	_pyInit();
+	// create the event before signalling, UnloadPython may set it any time after that
+	PyRun_SimpleString("import threading, samp\nsamp.exit_listener = threading.Event()");
+	m_pyReady.Set();
+
+	// run a main loop; this thread still holds the GIL, waiting for the event releases it
+	PyRun_SimpleString("import samp\nsamp.exit_listener.wait()");
 	_pyExit();
 	return 0;
+}
 #endif
+#if ENABLE_SUBINTERPRETERS
+// creates a new interpreter with its own GIL and imports the module in it;
+// expects the main interpreter's GIL to be held and returns with it held again
+static PyThreadState *_pyNewInterp(char *pyscript, PyObject **mod)
+{
+	PyInterpreterConfig config;
+	memset(&config, 0, sizeof(config));
+	config.use_main_obmalloc = 0;
+	config.allow_fork = 0;
+	config.allow_exec = 0;
+	config.allow_threads = 1;
+	config.allow_daemon_threads = 0;
+	config.check_multi_interp_extensions = 1;
+	config.gil = PyInterpreterConfig_OWN_GIL;
+
+	PyThreadState *mainstate = PyThreadState_Get();
+	PyThreadState *tstate = NULL;
+	PyStatus status = Py_NewInterpreterFromConfig(&tstate, &config);
+	if (PyStatus_Exception(status) || tstate == NULL)
+	{
+		// Python already switched back to mainstate
+		logprintf("PYTHON: Init: ERROR creating an interpreter for module %s: %s", pyscript, status.err_msg ? status.err_msg : "unknown error");
+		*mod = NULL;
+		return NULL;
+	}
+
+	PyRun_SimpleString("import sys; sys.path.append('.'); del sys");
+	*mod = PyImport_ImportModule(pyscript);
+	if (*mod == NULL)
+	{
+		logprintf("PYTHON: Init: ERROR loading module %s:", pyscript);
+		if (PyErr_Occurred() != NULL) _pyLogError();
+		Py_EndInterpreter(tstate);
+		PyEval_RestoreThread(mainstate);
+		return NULL;
+	}
+
+	PyObject *o = _pyCallFunc(*mod, "OnPyInit");
+	Py_XDECREF(o);
+	PyErr_Clear();
+
+	// back to the main interpreter
+	PyEval_SaveThread();
+	PyEval_RestoreThread(mainstate);
+	return tstate;
 }
-int _pyLoadModule(char *pyscript)
+#endif
+
+int _pyLoadModule(char *pyscript, bool isolated)
 {
+	if (isolated)
+	{
+#if ENABLE_SUBINTERPRETERS
+		py_module data;
+		data.tstate = _pyNewInterp(pyscript, &data.module);
+		if (data.tstate == NULL)
+			return 0;
+
+		m_pyModule.push_back(data);
+		return 1;
+#else
+		logprintf("PYTHON: Init: subinterpreters need Python 3.12, loading %s into the main interpreter", pyscript);
+#endif
+	}
+
 	PyObject *mod = PyImport_ImportModule(pyscript);
 	if (!mod)
 	{
@@ -590,7 +1300,8 @@ int _pyLoadModule(char *pyscript)
 		}
 		return 0;
 	}
-	m_pyModule.push_back(mod);
+	py_module data = { mod, NULL };
+	m_pyModule.push_back(data);
 	//_pyInitMacros(mod);
 	// call the init function in the python script (if available)
 	PyObject *o = _pyCallFunc(mod, "OnPyInit");
@@ -603,10 +1314,11 @@ void _pyExit()
 {
 	if (m_pyInited)
 	{
-		m_MainLock->Lock();
-		for (std::deque<PyObject*>::iterator i = m_pyModule.begin(); i != m_pyModule.end(); i++)
+		PyMainLock;
+		for (std::deque<py_module>::iterator i = m_pyModule.begin(); i != m_pyModule.end(); i++)
 		{
-			Py_DECREF(*i);
+			if (i->tstate == NULL) // isolated modules are gone with their interpreter
+				Py_DECREF(i->module);
 		}
 		m_pyModule.clear();
 
@@ -626,12 +1338,70 @@ void _pyExit()
 		}
 		m_MainLock->Unlock();
 
+		_playersClearCache();
 		Py_Finalize();
 
 		m_pyInited = false;
 	}
 }
 
+// shuts down all subinterpreters; has to be called from the server thread holding the main GIL
+void _pyExitInterpreters()
+{
+#if ENABLE_SUBINTERPRETERS
+	std::deque<py_module>::iterator i = m_pyModule.begin();
+	while (i != m_pyModule.end())
+	{
+		if (i->tstate == NULL)
+		{
+			i++;
+			continue;
+		}
+
+		PyThreadState *mainstate = PyEval_SaveThread();
+		PyEval_RestoreThread(i->tstate);
+		PyInterpreterState *interp = PyThreadState_GetInterpreter(i->tstate);
+
+		// free timers and invokes which belong to this interpreter
+		PyMainLock;
+		std::deque<timer_data> timers;
+		for (std::deque<timer_data>::iterator t = m_TimerList.begin(); t != m_TimerList.end();)
+		{
+			if (t->interp == interp)
+			{
+				timers.push_back(*t);
+				t = m_TimerList.erase(t);
+			}
+			else t++;
+		}
+		std::queue<invoke_data> invokes, others;
+		while (!m_InvokeQueue.empty())
+		{
+			if (m_InvokeQueue.front().interp == interp) invokes.push(m_InvokeQueue.front());
+			else others.push(m_InvokeQueue.front());
+			m_InvokeQueue.pop();
+		}
+		m_InvokeQueue = others;
+		m_MainLock->Unlock();
+
+		for (std::deque<timer_data>::iterator t = timers.begin(); t != timers.end(); t++)
+			clearTimerData(t);
+		while (!invokes.empty())
+		{
+			Py_DECREF(invokes.front().func);
+			Py_XDECREF(invokes.front().params);
+			invokes.pop();
+		}
+
+		Py_DECREF(i->module);
+		Py_EndInterpreter(i->tstate);
+
+		PyEval_RestoreThread(mainstate);
+		i = m_pyModule.erase(i);
+	}
+#endif
+}
+
 void _pyInitMacros(PyObject *module)
 {
 	PyModule_AddIntMacro(module, MAX_PLAYER_NAME);
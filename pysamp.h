@@ -15,29 +15,85 @@
 //	along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #define ENABLE_MULTITHREAD	1
+#define ENABLE_GIL_STATS	1
 
-#if ENABLE_MULTITHREAD
-	#define PyEnsureGIL			PyGILState_STATE gstate = PyGILState_Ensure()
+#if ENABLE_MULTITHREAD && ENABLE_GIL_STATS
+	#include "gilstats.h"
+	#include "gilpriority.h"
+
+	// measures how long the calling function waited for the GIL and how long it held it,
+	// while enabled with enable_gil_stats; functions taking it in more than one place name
+	// each of them with PyEnsureGILNamed
+	#define PyEnsureGIL		PyEnsureGILNamed(__FUNCTION__)
+	#define PyEnsureGILNamed(name) \
+		static gil_histogram *gilhist = _gilRegister(name); \
+		bool gilstats = m_gilStatsEnabled; \
+		unsigned long long gilwait = gilstats ? GetMicroTickCount() : 0; \
+		bool gilprio = _gilServerWait(); \
+		PyGILState_STATE gstate = PyGILState_Ensure(); \
+		_gilServerAcquired(gilprio); \
+		unsigned long long gilheld = gilstats ? GetMicroTickCount() : 0; \
+		gilwait = gilheld - gilwait
+	#define PyReleaseGIL \
+		if (gilstats) _gilRecord(gilhist, gilwait, GetMicroTickCount() - gilheld); \
+		PyGILState_Release(gstate)
+#elif ENABLE_MULTITHREAD
+	#include "gilpriority.h"
+
+	#define PyEnsureGIL		PyEnsureGILNamed(__FUNCTION__)
+	#define PyEnsureGILNamed(name) \
+		bool gilprio = _gilServerWait(); \
+		PyGILState_STATE gstate = PyGILState_Ensure(); \
+		_gilServerAcquired(gilprio)
 	#define PyReleaseGIL		PyGILState_Release(gstate)
 #else
 	#define PyEnsureGIL
+	#define PyEnsureGILNamed(name)
 	#define PyReleaseGIL
 #endif
 
+// per-interpreter GIL (PEP 684)
+#define ENABLE_SUBINTERPRETERS	(PY_VERSION_HEX >= 0x030C0000)
+
+struct py_module
+{
+	PyObject *module;
+	PyThreadState *tstate; // server thread state in the module's own interpreter, NULL for the main interpreter
+};
+
 extern PyMethodDef _pySampMethods[];
+// only used by the server thread (LoadPython, callbacks), so it needs no lock;
+// AMX natives aren't thread safe either: worker threads should call them through InvokeFunction
+extern std::deque<py_module> m_pyModule;
 extern bool m_pyInited;
+extern Event m_pyReady;
+extern PyThreadState *m_pyMainState;
+
+bool _pyIsMainInterp();
+PyInterpreterState *_pyCurrentInterp();
+PyThreadState *_pyEnterInterp(PyInterpreterState *interp);
+void _pyLeaveInterp(PyThreadState *prev);
+void _pyExitInterpreters();
 
+PyTypeObject *_pyVec3Type(PyObject *module);
+PyTypeObject *_pyQuatType(PyObject *module);
+PyTypeObject *_pyCompiledType(PyObject *module);
+PyTypeObject *_pyPlayerColumnType(PyObject *module);
+bool _pyOutParam(PyObject *module, PyObject *o, char *kind, int *size);
+
+PyObject *_pyNewArray(const char *typecode, const void *data, Py_ssize_t size);
+PyObject *_pyNewView(void *data, Py_ssize_t count, const char *format, Py_ssize_t itemsize);
+int _pyParseFast(PyObject *const *args, Py_ssize_t nargs, const char *format, ...);
 PyObject *_pyCallObject(PyObject *func, PyObject *params);
 PyObject *_pyCallFunc(PyObject *module, const char *funcname, PyObject *args=NULL);
 cell _pyCallAll(const char *funcname, PyObject *args=NULL, int nondefval=0, int defval=1);
 
+void _pyInit();
 #if ENABLE_MULTITHREAD
-	THREAD_RETURN _pyInit(void *prm);
-#else
-	void _pyInit();
+	THREAD_RETURN _pyMainThread(void *prm);
 #endif
 
-int _pyLoadModule(char *pyscript);
+int _pyLoadModule(char *pyscript, bool isolated=false);
 void _pyExit();
 void _pyInitMacros(PyObject *module);
 
@@ -0,0 +1,354 @@
+"""Benchmarks for the Python plugin
+
+Load this module like a gamemode script (add "benchmark" to python.cfg);
+results are written to the server log. Which benchmarks run is set in
+BENCHMARKS below.
+"""
+
+import sys
+import time
+import samp
+
+BENCHMARKS = ['gil_priority', 'parallel', 'natives', 'vectors', 'chat', 'publics', 'spatial']
+
+def log(fmt, *args):
+	samp.printf('[benchmark] ' + (fmt % args if args else fmt))
+
+
+# ----------------------------------
+# GIL priority: callback latency under CPU-heavy background threads
+# ----------------------------------
+
+GIL_THREADS = 4
+GIL_PHASE_MS = 5000
+GIL_TIMER_MS = 10
+
+_gil_stop = False
+
+def _gil_burn():
+	# pure Python CPU work, never releases the GIL on its own
+	while not _gil_stop:
+		x = 0
+		for i in range(10000):
+			x += i * i
+
+def _gil_tick():
+	pass
+
+def _gil_percentile(hist, p):
+	"""upper bound (us) of the bucket containing the p-th percentile"""
+	total = sum(hist)
+	if total == 0:
+		return 0
+	seen = 0
+	for i, n in enumerate(hist):
+		seen += n
+		if seen >= total * p:
+			return 1 << i
+	return 1 << (len(hist) - 1)
+
+def _gil_report(name):
+	stats = samp.gil_stats().get('ProcessTick.timer')
+	if stats is None or stats['count'] == 0:
+		log('%s: no samples', name)
+		return
+	log('%s: %d callbacks, mean wait %.1f us, p50 < %d us, p99 < %d us',
+		name, stats['count'], stats['wait_total'] / float(stats['count']),
+		_gil_percentile(stats['wait'], 0.5), _gil_percentile(stats['wait'], 0.99))
+
+def bench_gil_priority(done):
+	global _gil_stop
+	_gil_stop = False
+	for i in range(GIL_THREADS):
+		samp.start_thread(_gil_burn)
+
+	timer = samp.SetTimer(_gil_tick, GIL_TIMER_MS, True)
+	samp.set_gil_priority(False)
+	samp.enable_gil_stats(True)
+	samp.reset_gil_stats()
+
+	def phase2():
+		_gil_report('gil_priority off')
+		samp.set_gil_priority(True)
+		samp.reset_gil_stats()
+		samp.SetTimer(finish, GIL_PHASE_MS, False)
+
+	def finish():
+		global _gil_stop
+		_gil_report('gil_priority on')
+		samp.set_gil_priority(False)
+		samp.enable_gil_stats(False)
+		samp.KillTimer(timer)
+		_gil_stop = True
+		done()
+
+	samp.SetTimer(phase2, GIL_PHASE_MS, False)
+
+
+# ----------------------------------
+# parallel: pure Python throughput of worker threads next to the tick loop;
+# only scales with the thread count on free-threaded builds (3.13t)
+# ----------------------------------
+
+PARALLEL_THREADS = [1, 2, 4]
+PARALLEL_PHASE_MS = 3000
+
+_par_stop = False
+
+def _par_work(counts, slot):
+	while not _par_stop:
+		x = 0
+		for i in range(10000):
+			x += i * i
+		counts[slot] += 1
+
+def bench_parallel(done):
+	gil = getattr(sys, '_is_gil_enabled', lambda: True)()
+	log('parallel: GIL %s', 'enabled' if gil else 'disabled')
+	timer = samp.SetTimer(_gil_tick, GIL_TIMER_MS, True)
+	samp.enable_gil_stats(True)
+	results = {}
+
+	def phase(threads):
+		global _par_stop
+		if not threads:
+			samp.KillTimer(timer)
+			samp.enable_gil_stats(False)
+			base = results[PARALLEL_THREADS[0]]
+			for n in PARALLEL_THREADS:
+				log('parallel %d threads: %.0f loops/s, %.2fx', n, results[n], results[n] / base if base else 0)
+			done()
+			return
+
+		n, rest = threads[0], threads[1:]
+		counts = [0] * n
+		_par_stop = False
+		samp.reset_gil_stats()
+		start = time.time()
+		for slot in range(n):
+			samp.start_thread(_par_work, (counts, slot))
+
+		def finish():
+			global _par_stop
+			_par_stop = True
+			results[n] = sum(counts) / (time.time() - start)
+			_gil_report('parallel %d' % n)
+			# give the workers a moment to see _par_stop
+			samp.SetTimer(lambda: phase(rest), 100, False)
+
+		samp.SetTimer(finish, PARALLEL_PHASE_MS, False)
+
+	phase(PARALLEL_THREADS)
+
+
+# ----------------------------------
+# natives: calls per second of representative wrappers, measured on the
+# server thread (player 0 doesn't need to be connected)
+# ----------------------------------
+
+NATIVES_MS = 1000
+
+NATIVES = [
+	('GetPlayerPos', lambda: samp.GetPlayerPos(0)),
+	('SendClientMessage', lambda: samp.SendClientMessage(0, 0xFFFFFFFF, 'benchmark')),
+	('SetPlayerHealth', lambda: samp.SetPlayerHealth(0, 100.0)),
+]
+
+def _natives_rate(call):
+	calls = 0
+	start = time.perf_counter()
+	end = start + NATIVES_MS / 1000.0
+	while True:
+		for i in range(1000):
+			call()
+		calls += 1000
+		now = time.perf_counter()
+		if now >= end:
+			return calls / (now - start)
+
+def bench_natives(done):
+	# one native per timer callback, so the server keeps ticking in between
+	def phase(natives):
+		if not natives:
+			done()
+			return
+		(name, call), rest = natives[0], natives[1:]
+		log('natives %s: %.0f calls/s', name, _natives_rate(call))
+		samp.SetTimer(lambda: phase(rest), 100, False)
+
+	samp.SetTimer(lambda: phase(NATIVES), 100, False)
+
+
+# ----------------------------------
+# vectors: cost of the samp.Vec3 results of the position getters, next to
+# the dicts they used to return
+# ----------------------------------
+
+VECTORS_COUNT = 10000
+
+def _vectors_blocks(make):
+	"""memory blocks allocated (and kept alive) per result"""
+	before = sys.getallocatedblocks()
+	keep = [make() for i in range(VECTORS_COUNT)]
+	blocks = sys.getallocatedblocks() - before
+	del keep
+	# the list itself is a single block, small enough to ignore
+	return blocks / float(VECTORS_COUNT)
+
+def _vectors_rate(call):
+	start = time.perf_counter()
+	for i in range(VECTORS_COUNT):
+		call()
+	return VECTORS_COUNT / (time.perf_counter() - start)
+
+def bench_vectors(done):
+	pos = samp.GetPlayerPos(0)
+
+	def as_dict():
+		# what the getters used to return
+		x, y, z = samp.GetPlayerPos(0)
+		return {'x': x, 'y': y, 'z': z}
+
+	def unpack():
+		x, y, z = pos
+
+	log('vectors Vec3: %.1f blocks, %d bytes per result',
+		_vectors_blocks(lambda: samp.GetPlayerPos(0)), sys.getsizeof(pos))
+	log('vectors dict: %.1f blocks, %d bytes per result',
+		_vectors_blocks(as_dict), sys.getsizeof(as_dict()))
+	log('vectors GetPlayerPos: %.0f calls/s, with dict %.0f calls/s',
+		_vectors_rate(lambda: samp.GetPlayerPos(0)), _vectors_rate(as_dict))
+	log('vectors access: .x %.0f/s, [\'x\'] %.0f/s, unpacking %.0f/s',
+		_vectors_rate(lambda: pos.x), _vectors_rate(lambda: pos['x']), _vectors_rate(unpack))
+	done()
+
+
+# ----------------------------------
+# chat: string-heavy natives, both directions of the cp1252 codec; the
+# players don't need to be connected
+# ----------------------------------
+
+CHAT_MESSAGES = [
+	('ascii', 'Welcome to the server, type /help for a list of commands'),
+	('latin-1', 'Gr\u00fc\u00dfe aus M\u00fcnchen, sch\u00f6nes Wetter heute'),
+	('cp1252', '\u201cquoted\u201d \u2013 costs 5 \u20ac \u2026 and more'),
+]
+
+def bench_chat(done):
+	everyone = list(range(50))
+	tests = []
+	for name, msg in CHAT_MESSAGES:
+		tests.append(('SendClientMessage ' + name, lambda msg=msg: samp.SendClientMessage(0, 0xFFFFFFFF, msg)))
+		tests.append(('SendClientMessageMany(50) ' + name, lambda msg=msg: samp.SendClientMessageMany(everyone, 0xFFFFFFFF, msg)))
+	# out buffer of 401 cells, decoded back to str
+	tests.append(('GetPlayerNetworkStats', lambda: samp.GetPlayerNetworkStats(0)))
+
+	def phase(tests):
+		if not tests:
+			done()
+			return
+		(name, call), rest = tests[0], tests[1:]
+		log('chat %s: %.0f calls/s', name, _natives_rate(call))
+		samp.SetTimer(lambda: phase(rest), 100, False)
+
+	samp.SetTimer(lambda: phase(tests), 100, False)
+
+
+# ----------------------------------
+# publics: samp.public (amx_Exec) next to CallRemoteFunction, on publics of
+# pawn/python.pwn which call back into Python
+# ----------------------------------
+
+def bench_publics(done):
+	update = samp.public('OnPlayerUpdate', 'i')
+	rcon = samp.public('OnRconCommand', 's')
+	tests = [
+		('CallRemoteFunction OnPlayerUpdate', lambda: samp.CallRemoteFunction('OnPlayerUpdate', 'i', 0)),
+		('samp.public OnPlayerUpdate', lambda: update(0)),
+		('CallRemoteFunction OnRconCommand', lambda: samp.CallRemoteFunction('OnRconCommand', 's', 'benchmark')),
+		('samp.public OnRconCommand', lambda: rcon('benchmark')),
+	]
+
+	def phase(tests):
+		if not tests:
+			done()
+			return
+		(name, call), rest = tests[0], tests[1:]
+		log('publics %s: %.0f calls/s', name, _natives_rate(call))
+		samp.SetTimer(lambda: phase(rest), 100, False)
+
+	samp.SetTimer(lambda: phase(tests), 100, False)
+
+
+# ----------------------------------
+# spatial: proximity queries through the per-tick grid, next to the Python
+# loops over the connected players they replace; the numbers only mean
+# something with players (or NPCs) connected
+# ----------------------------------
+
+SPATIAL_RANGE = 30.0
+SPATIAL_NEAREST = 5
+
+def _spatial_loop_range(x, y, z, world, interior):
+	return [p for p in samp.connected_players()
+		if samp.GetPlayerVirtualWorld(p) == world and samp.GetPlayerInterior(p) == interior
+		and samp.IsPlayerInRangeOfPoint(p, SPATIAL_RANGE, x, y, z)]
+
+def _spatial_loop_nearest(playerid):
+	x, y, z = samp.GetPlayerPos(playerid)
+	world, interior = samp.GetPlayerVirtualWorld(playerid), samp.GetPlayerInterior(playerid)
+	near = []
+	for p in samp.connected_players():
+		if p == playerid or samp.GetPlayerVirtualWorld(p) != world or samp.GetPlayerInterior(p) != interior:
+			continue
+		px, py, pz = samp.GetPlayerPos(p)
+		near.append(((px - x) ** 2 + (py - y) ** 2 + (pz - z) ** 2, p))
+	near.sort()
+	return [p for d, p in near[:SPATIAL_NEAREST]]
+
+def bench_spatial(done):
+	players = samp.connected_players()
+	if len(players) == 0:
+		log('spatial: no players connected, skipped')
+		done()
+		return
+	pid = players[0]
+	x, y, z = samp.GetPlayerPos(pid)
+	world, interior = samp.GetPlayerVirtualWorld(pid), samp.GetPlayerInterior(pid)
+	# the first grid is built on the next tick
+	samp.enable_spatial_index(True)
+
+	tests = [
+		('range loop', lambda: _spatial_loop_range(x, y, z, world, interior)),
+		('players_in_range', lambda: samp.players_in_range(x, y, z, SPATIAL_RANGE, world=world, interior=interior)),
+		('players_in_range any world', lambda: samp.players_in_range(x, y, z, SPATIAL_RANGE)),
+		('nearest loop', lambda: _spatial_loop_nearest(pid)),
+		('nearest_players', lambda: samp.nearest_players(pid, SPATIAL_NEAREST)),
+	]
+
+	def phase(tests):
+		if not tests:
+			samp.enable_spatial_index(False)
+			done()
+			return
+		(name, call), rest = tests[0], tests[1:]
+		log('spatial %s (%d players): %.0f calls/s', name, len(players), _natives_rate(call))
+		samp.SetTimer(lambda: phase(rest), 100, False)
+
+	samp.SetTimer(lambda: phase(tests), 100, False)
+
+
+# ----------------------------------
+# runner
+# ----------------------------------
+
+def _run(names):
+	if not names:
+		log('finished')
+		return
+	name, rest = names[0], names[1:]
+	log('running %s', name)
+	globals()['bench_' + name](lambda: _run(rest))
+
+def OnPyInit():
+	_run(list(BENCHMARKS))
@@ -25,6 +25,12 @@
 #include "constants.h"
 #include "nativefunctions.h"
 #include "pysamp.h"
+#include "config.h"
+#include "scratch.h"
+#include "players.h"
+#include "compiledcall.h"
+#include "textdraws.h"
+#include "spatial.h"
 #ifndef _WIN32
 #include <dlfcn.h>
 #endif
@@ -41,6 +47,10 @@ std::deque<timer_data> m_TimerList; // TODO: deque or vector?
 std::queue<invoke_data> m_InvokeQueue;
 
 Mutex *m_MainLock;
+// id of the repeating timer ProcessTick is calling right now; if it gets killed meanwhile,
+// KillTimer leaves freeing it to ProcessTick
+long m_TimerRunning = 0;
+bool m_TimerRunningKilled = false;
 
 //----------------------------------------------------------
 
@@ -73,6 +83,14 @@ PLUGIN_EXPORT void PLUGIN_CALL ProcessTick()
 	static unsigned long long lasttickcount = GetTickCount();
 	unsigned long long curtickcount = GetTickCount();
 
+#if ENABLE_MULTITHREAD && ENABLE_GIL_STATS
+	_gilTick();
+#endif
+	// no Pawn code is running here, so the arena stays reserved
+	_scratchReserve();
+	_snapshotCapture();
+	_spatialUpdate();
+
 	// timers and function invokes
 	if (curtickcount - lasttickcount > 0) // prevent check if GetTickCount value hasn't changed
 	{
@@ -95,17 +113,31 @@ PLUGIN_EXPORT void PLUGIN_CALL ProcessTick()
 					else
 					{
 						i->lasttick = curtickcount;
+						// another thread might kill it before we got the GIL
+						m_TimerRunning = tmp.id;
+						m_TimerRunningKilled = false;
 					}
 
 					m_MainLock->Unlock(); // maybe this timer calls SetTimer or KillTimer, which also locks that mutex
-					PyEnsureGIL;
+					PyEnsureGILNamed("ProcessTick.timer");
+					PyThreadState *prev = _pyEnterInterp(tmp.interp);
 					_pyCallObject(tmp.func, tmp.params);
 
-					if (!tmp.repeating) // here we can free memory used by the timer
+					bool release = !tmp.repeating;
+					if (tmp.repeating)
+					{
+						// attached here: a plain Lock could stall a stop-the-world pause (see PyMainLock)
+						PyMainLock;
+						release = m_TimerRunningKilled;
+						m_TimerRunning = 0;
+						m_MainLock->Unlock();
+					}
+					if (release) // here we can free memory used by the timer
 					{
 						Py_DECREF(tmp.func);
 						Py_XDECREF(tmp.params);
 					}
+					_pyLeaveInterp(prev);
 					PyReleaseGIL;
 					m_MainLock->Lock();
 					break;
@@ -118,11 +150,13 @@ PLUGIN_EXPORT void PLUGIN_CALL ProcessTick()
 			m_InvokeQueue.pop();
 
 			m_MainLock->Unlock();
-			PyEnsureGIL;
+			PyEnsureGILNamed("ProcessTick.invoke");
+			PyThreadState *prev = _pyEnterInterp(inv.interp);
 			_pyCallObject(inv.func, inv.params);
 
 			Py_DECREF(inv.func);
 			Py_XDECREF(inv.params);
+			_pyLeaveInterp(prev);
 			PyReleaseGIL;
 		}
 		m_MainLock->Unlock();
@@ -141,8 +175,9 @@ PLUGIN_EXPORT bool PLUGIN_CALL Load(void **ppData)
 	logprintf = (logprintf_t)ppData[PLUGIN_DATA_LOGPRINTF];
 
 	m_MainLock = new Mutex(); // initialize main mutex
+	_loadConfig(PLUGIN_CONFIG_FILE);
 
-	logprintf("\tPython plugin loaded");
+	logprintf("\tPython plugin loaded (threading %s)", m_Config.multithread ? "multi" : "single");
 	return true;
 }
 
@@ -158,36 +193,62 @@ PLUGIN_EXPORT void PLUGIN_CALL Unload()
 }
 
 // Loads a specific python script
+// LoadPython(module[], isolated = -1): isolated modules get their own interpreter and GIL (Python 3.12+);
+// -1 uses the isolated setting from the plugin config
 static cell AMX_NATIVE_CALL n_LoadPython(AMX* amx, cell* params)
 {
 	if (params[0] == 0) return 0;
 
 	char *str = _getString(amx, params[1]);
+	bool isolated = m_Config.isolated;
+	if (params[0] / sizeof(cell) >= 2 && params[2] >= 0)
+		isolated = params[2] != 0;
 	
+	// time from the first LoadPython until its module returned from OnPyInit
+	unsigned long long start = 0;
 	if (!m_pyInited)
 	{
+		start = GetMicroTickCount();
 		_initAMX(amx);
+		_playersInit();
+		if (m_Config.multithread)
+		{
 		#if ENABLE_MULTITHREAD
 			#ifdef _WIN32
-				m_pyMainThread = CreateThread(NULL, 0, _pyInit, NULL, 0, NULL);
+				m_pyMainThread = CreateThread(NULL, 0, _pyMainThread, NULL, 0, NULL);
 			#else
-				pthread_create(&m_pyMainThread, NULL, _pyInit, NULL);
+				pthread_create(&m_pyMainThread, NULL, _pyMainThread, NULL);
 			#endif
 
 			// wait for the Python main thread to initialize Python
-			while(!Py_IsInitialized())
-				sleep(.01);
-		#else
+			m_pyReady.Wait();
+		#endif
+		}
+		else
+		{
 			_pyInit();
+		#if ENABLE_MULTITHREAD
+			// callbacks take the GIL with PyEnsureGIL, so don't keep it between them
+			m_pyMainState = PyEval_SaveThread();
 		#endif
+		}
+		logprintf("PYTHON: Python initialized in %.2f ms (threading %s)",
+			(GetMicroTickCount() - start) / 1000.0, m_Config.multithread ? "multi" : "single");
+
+	#if ENABLE_MULTITHREAD && !defined(Py_GIL_DISABLED)
+		m_gilPriority = m_Config.gil_priority;
+	#endif
+	#if ENABLE_MULTITHREAD && ENABLE_GIL_STATS
+		m_gilStatsEnabled = m_Config.gil_stats;
+	#endif
+		m_snapshotEnabled = m_Config.snapshot;
 	}
-	// wait until the Python main thread has completely initialized
-	m_MainLock->Lock();
-	m_MainLock->Unlock(); // and unlock it
 
 	PyEnsureGIL;
-	cell ret = _pyLoadModule(str);
+	cell ret = _pyLoadModule(str, isolated);
 	PyReleaseGIL;
+	if (start != 0)
+		logprintf("PYTHON: %s ready %.2f ms after LoadPython (OnPyInit included)", str, (GetMicroTickCount() - start) / 1000.0);
 	_del(str);
 	return ret;
 }
@@ -197,7 +258,10 @@ static cell AMX_NATIVE_CALL n_UnloadPython( AMX* amx, cell* params )
 	PyEnsureGIL;
 	// call exit functions
 	_pyCallAll("OnPyExit");
+	_pyExitInterpreters();
 
+	if (m_Config.multithread)
+	{
 	#if ENABLE_MULTITHREAD
 		// set the exit_listener event in the samp module to let the Python main thread exit
 		PyRun_SimpleString("import samp\nsamp.exit_listener.set()");
@@ -208,9 +272,16 @@ static cell AMX_NATIVE_CALL n_UnloadPython( AMX* amx, cell* params )
 		#else
 			pthread_join(m_pyMainThread, NULL);
 		#endif
-	#else
-		_pyExit();
 	#endif
+	}
+	else
+	{
+		PyReleaseGIL;
+	#if ENABLE_MULTITHREAD
+		PyEval_RestoreThread(m_pyMainState);
+	#endif
+		_pyExit();
+	}
 	return 0;
 }
 
@@ -281,6 +352,7 @@ PLUGIN_EXPORT int PLUGIN_CALL AmxLoad( AMX *amx )
 {
 	// DONE: move to LoadPython function, as it would also load in filterscripts here
 	//_initAMX(amx);
+	_compiledAmxLoad(amx);
 
 	return amx_Register( amx, HelloWorldNatives, -1 );
 }
@@ -291,6 +363,10 @@ PLUGIN_EXPORT int PLUGIN_CALL AmxLoad( AMX *amx )
 
 PLUGIN_EXPORT int PLUGIN_CALL AmxUnload( AMX *amx ) 
 {
+	_scratchUnload(amx);
+	_nativeCacheClear(amx);
+	_compiledAmxUnload(amx);
+	_textdrawsUnload(amx);
 	return AMX_ERR_NONE;
 }
 
@@ -305,3 +381,36 @@ PLUGIN_EXPORT int PLUGIN_CALL AmxUnload( AMX *amx )
 		return (tv.tv_sec * 1000) + (tv.tv_usec / 1000ULL);
 	}
 #endif
+
+// monotonic clock in microseconds, used for profiling
+unsigned long long GetMicroTickCount()
+{
+#ifdef _WIN32
+	static LARGE_INTEGER freq = { 0 };
+	LARGE_INTEGER now;
+	if (freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+	// split, now * 1000000 overflows after some days of uptime
+	return (unsigned long long)(now.QuadPart / freq.QuadPart * 1000000ULL + now.QuadPart % freq.QuadPart * 1000000ULL / freq.QuadPart);
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000ULL) + (ts.tv_nsec / 1000);
+#endif
+}
+
+// the same clock in nanoseconds, for timing single native calls
+unsigned long long GetNanoTickCount()
+{
+#ifdef _WIN32
+	static LARGE_INTEGER freq = { 0 };
+	LARGE_INTEGER now;
+	if (freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+	return (unsigned long long)(now.QuadPart / freq.QuadPart * 1000000000ULL + now.QuadPart % freq.QuadPart * 1000000000ULL / freq.QuadPart);
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000ULL) + ts.tv_nsec;
+#endif
+}
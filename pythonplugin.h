@@ -19,6 +19,8 @@
 
 #include <deque>
 #include <queue>
+#include <vector>
+#include <string>
 
 // include Python header; prevent it from using its debug library
 #ifdef _DEBUG
@@ -37,6 +39,7 @@
 	#include <Windows.h>
 #else
 	#include <sys/time.h>
+	#include <time.h>
 	#include <pthread.h>
 #endif
 
@@ -54,6 +57,7 @@ struct invoke_data
 {
 	PyObject *func;
 	PyObject *params;
+	PyInterpreterState *interp; // interpreter func belongs to
 };
 struct timer_data
 {
@@ -63,11 +67,30 @@ struct timer_data
 	int interval;
 	bool repeating;
 	unsigned long long lasttick;
+	PyInterpreterState *interp; // interpreter func belongs to
 };
 
+// m_TimerList and m_InvokeQueue are shared between the server thread and any Python thread;
+// only touch them while holding m_MainLock
 extern std::deque<timer_data> m_TimerList;
 extern std::queue<invoke_data> m_InvokeQueue;
 extern Mutex *m_MainLock;
+extern long m_TimerRunning;
+extern bool m_TimerRunningKilled;
+
+// locks m_MainLock from a thread with an attached thread state; in free-threaded builds
+// it has to be detached while blocking, or it would stall the garbage collector's stop-the-world pauses
+#ifdef Py_GIL_DISABLED
+	#define PyMainLock		Py_BEGIN_ALLOW_THREADS m_MainLock->Lock(); Py_END_ALLOW_THREADS
+#else
+	#define PyMainLock		m_MainLock->Lock()
+#endif
+
+// per-object locks for mutable containers; only do something in free-threaded builds
+#ifndef Py_BEGIN_CRITICAL_SECTION
+	#define Py_BEGIN_CRITICAL_SECTION(op)	{
+	#define Py_END_CRITICAL_SECTION()		}
+#endif
 
 #ifdef _WIN32
 	#define GetTickCount		GetTickCount64
@@ -75,11 +98,20 @@ extern Mutex *m_MainLock;
 	
 	#define THREAD_RETURN		DWORD WINAPI
 	#define TID_TYPE			HANDLE
+
+	#define _atomicInc(x)		InterlockedIncrement(&(x))
+	#define _atomicDec(x)		InterlockedDecrement(&(x))
 #else
 	unsigned long long GetTickCount();
 
 	#define THREAD_RETURN		void *
 	#define TID_TYPE		pthread_t
+
+	#define _atomicInc(x)		__sync_add_and_fetch(&(x), 1)
+	#define _atomicDec(x)		__sync_sub_and_fetch(&(x), 1)
 #endif
 
+unsigned long long GetMicroTickCount();
+unsigned long long GetNanoTickCount();
+
 #endif
@@ -0,0 +1,117 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "pythonplugin.h"
+#include "scratch.h"
+
+// The arena sits on the AMX heap, allotted once and never released. Calls into the
+// arena only bump an offset, so marshalling doesn't touch the heap top at all.
+//
+// It can't be allotted from a native (like LoadPython): the interpreter keeps its own
+// copy of the heap top and writes it back when the native returns, so ProcessTick
+// reserves it, which runs outside of any Pawn code.
+//
+// The arena can only be used while it is the top of the heap: when Pawn code called
+// from Python (CallRemoteFunction) calls back into Python, that Pawn code may have
+// allotted cells above it. Allocations then fall back to amx_Allot, and
+// _scratchRelease gives them back.
+//
+// Like the natives themselves, this is only used on the server thread.
+struct scratch_arena
+{
+	AMX *amx;
+	int size;		// cells, decided at _initAMX
+	bool reserved;
+	cell base;		// AMX address of the arena
+	cell *phys;		// physical address of the arena
+	cell end;		// heap top right after the arena
+	int top;		// next free cell
+};
+
+static scratch_arena m_scratch = { NULL, 0, false, 0, NULL, 0, 0 };
+
+void _scratchInit(AMX *amx)
+{
+	m_scratch.amx = amx;
+	m_scratch.reserved = false;
+	m_scratch.top = 0;
+
+	// leave most of the heap/stack space to the script
+	int avail = (int)((amx->stk - amx->hea) / sizeof(cell));
+	m_scratch.size = avail / 4 < MAX_SCRATCH_CELLS ? avail / 4 : MAX_SCRATCH_CELLS;
+}
+
+void _scratchReserve()
+{
+	if (m_scratch.reserved || m_scratch.amx == NULL || m_scratch.size == 0)
+		return;
+
+	if (amx_Allot(m_scratch.amx, m_scratch.size, &m_scratch.base, &m_scratch.phys) != AMX_ERR_NONE)
+	{
+		logprintf("PYTHON: Could not reserve %d AMX heap cells for marshalling", m_scratch.size);
+		m_scratch.size = 0;
+		return;
+	}
+	m_scratch.end = m_scratch.amx->hea;
+	m_scratch.top = 0;
+	m_scratch.reserved = true;
+}
+
+// the AMX (and the arena with it) is gone
+void _scratchUnload(AMX *amx)
+{
+	if (amx == m_scratch.amx)
+	{
+		m_scratch.amx = NULL;
+		m_scratch.reserved = false;
+	}
+}
+
+scratch_mark _scratchMark()
+{
+	scratch_mark mark = { m_scratch.top, m_AMX->hea };
+	return mark;
+}
+
+// returns the physical address of cells and stores their AMX address in amx_addr;
+// on errors NULL is returned with a Python exception set
+cell *_scratchAllot(int cells, cell *amx_addr)
+{
+	if (m_scratch.reserved && m_AMX == m_scratch.amx && m_AMX->hea == m_scratch.end
+		&& cells <= m_scratch.size - m_scratch.top)
+	{
+		*amx_addr = m_scratch.base + m_scratch.top * sizeof(cell);
+		cell *addr = m_scratch.phys + m_scratch.top;
+		m_scratch.top += cells;
+		return addr;
+	}
+
+	cell *addr;
+	if (amx_Allot(m_AMX, cells, amx_addr, &addr) != AMX_ERR_NONE)
+	{
+		PyErr_SetString(PyExc_MemoryError, "AMX heap is full");
+		return NULL;
+	}
+	return addr;
+}
+
+void _scratchRelease(const scratch_mark &mark)
+{
+	m_scratch.top = mark.top;
+	if (m_AMX->hea > mark.hea)
+		amx_Release(m_AMX, mark.hea);
+}
@@ -0,0 +1,40 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef __scratch_h_
+#define __scratch_h_
+
+// AMX heap cells kept reserved for marshalling native arguments;
+// _initAMX lowers this when the script has less than 4x as much heap/stack space
+#define MAX_SCRATCH_CELLS	1024
+
+// position to return to with _scratchRelease; marks nest like the calls they belong to
+struct scratch_mark
+{
+	int top;	// bump offset in the arena
+	cell hea;	// AMX heap top, everything above it was allotted by the fallback
+};
+
+void _scratchInit(AMX *amx);
+void _scratchReserve();
+void _scratchUnload(AMX *amx);
+
+scratch_mark _scratchMark();
+cell *_scratchAllot(int cells, cell *amx_addr);
+void _scratchRelease(const scratch_mark &mark);
+
+#endif
@@ -0,0 +1,499 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "pythonplugin.h"
+#include <math.h>
+#include "nativefunctions.h"
+#include "pysamp.h"
+#include "players.h"
+#include "spatial.h"
+
+// world or interior of a query that matches all of them
+#define ANY		-1
+// distinct virtual worlds a grid lists for queries in any world; with more of them
+// those queries scan every entry
+#define MAX_GRID_WORLDS		16
+
+struct grid_entry
+{
+	cell id;				// -1 once the player disconnected
+	int cx, cy;
+	cell world, interior;	// vehicles have interior 0, no native reads theirs
+	float x, y, z;
+};
+
+// entries sorted by bucket: bucket b holds entries[start[b]] up to entries[start[b + 1]]
+struct spatial_grid
+{
+	int count;
+	int start[GRID_BUCKETS + 1];
+	grid_entry *entries;
+	int worldCount;					// -1 for more than MAX_GRID_WORLDS
+	cell worlds[MAX_GRID_WORLDS];
+};
+
+bool m_spatialEnabled = false;
+static bool m_spatialVehicles = false;
+
+static grid_entry m_playerEntries[MAX_PLAYERS], m_vehicleEntries[MAX_VEHICLES];
+static spatial_grid m_playerGrid = { 0, { 0 }, m_playerEntries };
+static spatial_grid m_vehicleGrid = { 0, { 0 }, m_vehicleEntries };
+// index of every player's entry in m_playerGrid, only valid if the entry has its id
+static int m_playerEntry[MAX_PLAYERS];
+// rebuilt by the server thread, queries may come from Python worker threads
+static Mutex m_gridLock;
+
+static int _gridCell(float v)
+{
+	float c = floorf(v / GRID_CELL_SIZE);
+	// far outside the map, or NaN
+	if (!(c > -1000000.0f))
+		return -1000000;
+	if (c > 1000000.0f)
+		return 1000000;
+	return (int)c;
+}
+
+// interiors aren't part of the key, each query filters them per entry
+static unsigned int _gridBucket(int cx, int cy, cell world)
+{
+	unsigned int h = (unsigned int)cx * 73856093u ^ (unsigned int)cy * 19349663u ^ (unsigned int)world * 83492791u;
+	return (h ^ (h >> 15)) & (GRID_BUCKETS - 1);
+}
+
+static void _gridEntry(grid_entry *e, cell id, float x, float y, float z, cell world, cell interior)
+{
+	e->id = id;
+	e->cx = _gridCell(x);
+	e->cy = _gridCell(y);
+	e->world = world;
+	e->interior = interior;
+	e->x = x;
+	e->y = y;
+	e->z = z;
+}
+
+static void _gridClear(spatial_grid *grid)
+{
+	grid->count = 0;
+	grid->worldCount = 0;
+	memset(grid->start, 0, sizeof(grid->start));
+}
+
+static void _gridAddWorld(spatial_grid *grid, cell world)
+{
+	if (grid->worldCount == -1)
+		return;
+	for (int i = 0; i < grid->worldCount; i++)
+	{
+		if (grid->worlds[i] == world)
+			return;
+	}
+	if (grid->worldCount == MAX_GRID_WORLDS)
+		grid->worldCount = -1;
+	else
+		grid->worlds[grid->worldCount++] = world;
+}
+
+// counting sort of the count entries of src into grid; called with m_gridLock held
+static void _gridBuild(spatial_grid *grid, const grid_entry *src, int count)
+{
+	static unsigned short buckets[MAX_VEHICLES];
+	static int next[GRID_BUCKETS];
+
+	_gridClear(grid);
+	for (int i = 0; i < count; i++)
+	{
+		buckets[i] = (unsigned short)_gridBucket(src[i].cx, src[i].cy, src[i].world);
+		grid->start[buckets[i] + 1]++;
+		_gridAddWorld(grid, src[i].world);
+	}
+	for (int b = 0; b < GRID_BUCKETS; b++)
+		grid->start[b + 1] += grid->start[b];
+
+	memcpy(next, grid->start, sizeof(next));
+	for (int i = 0; i < count; i++)
+	{
+		int index = next[buckets[i]]++;
+		grid->entries[index] = src[i];
+		if (grid == &m_playerGrid)
+			m_playerEntry[src[i].id] = index;
+	}
+	grid->count = count;
+}
+
+// called by ProcessTick after _snapshotCapture, without the GIL
+void _spatialUpdate()
+{
+	if (!m_spatialEnabled || m_AMX == NULL)
+		return;
+
+	static grid_entry players[MAX_PLAYERS], vehicles[MAX_VEHICLES];
+	int np = 0, nv = 0;
+
+	// ProcessTick runs outside of Pawn code, so allotting is safe
+	cell base, *out;
+	if (amx_Allot(m_AMX, 3, &base, &out) != AMX_ERR_NONE)
+		return;
+
+	cell one[2] = { sizeof(cell) };
+	cell four[5] = { 4 * sizeof(cell), 0, base, base + sizeof(cell), base + 2 * sizeof(cell) };
+
+	if (m_snapshotEnabled)
+	{
+		// already read for this tick
+		for (int i = 0; i < m_snapshot.count; i++)
+		{
+			_gridEntry(&players[np++], m_snapshot.id[i], m_snapshot.x[i], m_snapshot.y[i], m_snapshot.z[i],
+				m_snapshot.world[i], m_snapshot.interior[i]);
+		}
+	}
+	else
+	{
+		cell ids[MAX_PLAYERS];
+		int count = _playersCopy(ids);
+		for (int i = 0; i < count; i++)
+		{
+			one[1] = four[1] = ids[i];
+			_getPlayerPos(m_AMX, four);
+			_gridEntry(&players[np++], ids[i], amx_ctof(out[0]), amx_ctof(out[1]), amx_ctof(out[2]),
+				_getPlayerVirtualWorld(m_AMX, one), _getPlayerInterior(m_AMX, one));
+		}
+	}
+
+	// no native returns the highest vehicle id, so every id is tried; GetVehiclePos
+	// returns 0 for vehicles that don't exist
+	for (cell id = 1; m_spatialVehicles && id < MAX_VEHICLES; id++)
+	{
+		one[1] = four[1] = id;
+		if (_getVehiclePos(m_AMX, four) == 0)
+			continue;
+		_gridEntry(&vehicles[nv++], id, amx_ctof(out[0]), amx_ctof(out[1]), amx_ctof(out[2]),
+			_getVehicleVirtualWorld(m_AMX, one), 0);
+	}
+	amx_Release(m_AMX, base);
+
+	m_gridLock.Lock();
+	if (m_spatialEnabled)
+	{
+		_gridBuild(&m_playerGrid, players, np);
+		if (m_spatialVehicles)
+			_gridBuild(&m_vehicleGrid, vehicles, nv);
+	}
+	m_gridLock.Unlock();
+}
+
+// entry of a player in the last tick's grid, NULL if it has none
+static grid_entry *_gridPlayer(cell playerid)
+{
+	int index = m_playerEntry[playerid];
+	if (index < 0 || index >= m_playerGrid.count || m_playerGrid.entries[index].id != playerid)
+		return NULL;
+	return &m_playerGrid.entries[index];
+}
+
+// players who left since the last tick aren't returned by queries
+void _spatialPlayerDisconnect(cell playerid)
+{
+	if (playerid < 0 || playerid >= MAX_PLAYERS)
+		return;
+
+	m_gridLock.Lock();
+	grid_entry *e = _gridPlayer(playerid);
+	if (e != NULL)
+		e->id = -1;
+	m_gridLock.Unlock();
+}
+
+static int _idCompare(const void *a, const void *b)
+{
+	cell ia = *(const cell *)a, ib = *(const cell *)b;
+	return ia < ib ? -1 : (ia > ib ? 1 : 0);
+}
+
+// ids of the entries within r of (x, y, z), sorted; called with m_gridLock held
+static int _gridInRange(const spatial_grid *grid, float x, float y, float z, float r, cell world, cell interior, cell *ids)
+{
+	float r2 = r * r;
+	int n = 0;
+	int x0 = _gridCell(x - r), x1 = _gridCell(x + r), y0 = _gridCell(y - r), y1 = _gridCell(y + r);
+	double cells = ((double)x1 - x0 + 1) * ((double)y1 - y0 + 1);
+
+	// any world looks up the cells of every world in the grid
+	const cell *worlds = &world;
+	int worldCount = 1;
+	if (world == ANY)
+	{
+		worlds = grid->worlds;
+		worldCount = grid->worldCount;
+	}
+
+	// huge ranges, or too many worlds, are cheaper to scan
+	if (worldCount == -1 || cells * worldCount > grid->count)
+	{
+		for (int i = 0; i < grid->count; i++)
+		{
+			const grid_entry *e = &grid->entries[i];
+			float dx = e->x - x, dy = e->y - y, dz = e->z - z;
+			if (e->id != -1 && (world == ANY || e->world == world) && (interior == ANY || e->interior == interior)
+				&& dx * dx + dy * dy + dz * dz <= r2)
+				ids[n++] = e->id;
+		}
+	}
+	else
+	{
+		for (int w = 0; w < worldCount; w++)
+		{
+			for (int cy = y0; cy <= y1; cy++)
+			{
+				for (int cx = x0; cx <= x1; cx++)
+				{
+					unsigned int b = _gridBucket(cx, cy, worlds[w]);
+					for (int i = grid->start[b]; i < grid->start[b + 1]; i++)
+					{
+						const grid_entry *e = &grid->entries[i];
+						float dx = e->x - x, dy = e->y - y, dz = e->z - z;
+						if (e->id != -1 && e->cx == cx && e->cy == cy && e->world == worlds[w]
+							&& (interior == ANY || e->interior == interior) && dx * dx + dy * dy + dz * dz <= r2)
+							ids[n++] = e->id;
+					}
+				}
+			}
+		}
+	}
+	qsort(ids, n, sizeof(cell), _idCompare);
+	return n;
+}
+
+struct grid_hit
+{
+	float d2;
+	cell id;
+};
+
+static int _hitCompare(const void *a, const void *b)
+{
+	const grid_hit *ha = (const grid_hit *)a, *hb = (const grid_hit *)b;
+	if (ha->d2 != hb->d2)
+		return ha->d2 < hb->d2 ? -1 : 1;
+	return ha->id < hb->id ? -1 : (ha->id > hb->id ? 1 : 0);
+}
+
+static void _gridHit(const grid_entry *p, const grid_entry *e, grid_hit *hits, int *n)
+{
+	if (e == p || e->id == -1 || e->world != p->world || e->interior != p->interior)
+		return;
+	float dx = e->x - p->x, dy = e->y - p->y, dz = e->z - p->z;
+	hits[*n].d2 = dx * dx + dy * dy + dz * dz;
+	hits[*n].id = e->id;
+	(*n)++;
+}
+
+// the k players nearest to playerid in its world and interior, nearest first. The
+// search grows ring by ring around the player's cell: once the k-th nearest hit is
+// closer than the rings cover, no other player can be nearer. Called with m_gridLock held.
+static int _gridNearest(cell playerid, int k, cell *ids)
+{
+	const grid_entry *p = _gridPlayer(playerid);
+	if (p == NULL || k == 0)
+		return 0;
+
+	grid_hit hits[MAX_PLAYERS];
+	int n = 0;
+	for (int ring = 0;; ring++)
+	{
+		if ((2 * ring + 1) * (2 * ring + 1) > m_playerGrid.count)
+		{
+			// the next ring has more cells than there are players
+			n = 0;
+			for (int i = 0; i < m_playerGrid.count; i++)
+				_gridHit(p, &m_playerGrid.entries[i], hits, &n);
+			qsort(hits, n, sizeof(grid_hit), _hitCompare);
+			break;
+		}
+
+		for (int cy = p->cy - ring; cy <= p->cy + ring; cy++)
+		{
+			bool edge = cy == p->cy - ring || cy == p->cy + ring;
+			for (int cx = p->cx - ring; cx <= p->cx + ring; cx += edge || ring == 0 ? 1 : 2 * ring)
+			{
+				unsigned int b = _gridBucket(cx, cy, p->world);
+				for (int i = m_playerGrid.start[b]; i < m_playerGrid.start[b + 1]; i++)
+				{
+					const grid_entry *e = &m_playerGrid.entries[i];
+					if (e->cx == cx && e->cy == cy)
+						_gridHit(p, e, hits, &n);
+				}
+			}
+		}
+
+		if (n >= k)
+		{
+			qsort(hits, n, sizeof(grid_hit), _hitCompare);
+			float covered = ring * GRID_CELL_SIZE;
+			if (hits[k - 1].d2 <= covered * covered)
+				break;
+		}
+	}
+
+	if (n > k)
+		n = k;
+	for (int i = 0; i < n; i++)
+		ids[i] = hits[i].id;
+	return n;
+}
+
+// keyword arguments of a range query: values[j] gets the one named names[j], after
+// given of the count optional int arguments came positionally; false with TypeError set
+// for unknown names and arguments given twice
+static bool _spatialKeywords(const char *func, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames,
+	const char *const *names, int count, Py_ssize_t given, int *values)
+{
+	if (kwnames == NULL)
+		return true;
+
+	for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(kwnames); i++)
+	{
+		PyObject *name = PyTuple_GET_ITEM(kwnames, i);
+		int j = 0;
+		while (j < count && PyUnicode_CompareWithASCIIString(name, names[j]) != 0)
+			j++;
+		if (j == count)
+		{
+			PyErr_Format(PyExc_TypeError, "%s() got an unexpected keyword argument '%U'", func, name);
+			return false;
+		}
+		if (j < given)
+		{
+			PyErr_Format(PyExc_TypeError, "%s() got multiple values for argument '%s'", func, names[j]);
+			return false;
+		}
+		if (!_pyParseFast(&args[nargs + i], 1, "i", &values[j]))
+			return false;
+	}
+	return true;
+}
+
+// enable_spatial_index(enabled, vehicles = False)
+// the index is first built on the next server tick; vehicles are indexed too with
+// vehicles = True, which tries every vehicle id each tick
+PyObject *sEnableSpatialIndex(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	int enabled, vehicles = 0;
+	_pyParseFast(args, nargs, "p|p", &enabled, &vehicles);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	m_gridLock.Lock();
+	m_spatialEnabled = enabled != 0;
+	m_spatialVehicles = m_spatialEnabled && vehicles != 0;
+	if (!m_spatialEnabled)
+		_gridClear(&m_playerGrid);
+	if (!m_spatialVehicles)
+		_gridClear(&m_vehicleGrid);
+	m_gridLock.Unlock();
+	Py_RETURN_NONE;
+}
+
+// players_in_range(x, y, z, r, world = -1, interior = -1)
+// returns the sorted ids of the players within r of the point as array('i'); -1 matches
+// every world or interior. world and interior can be passed by keyword
+PyObject *sPlayersInRange(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+	static const char *const names[] = { "world", "interior" };
+	float x, y, z, r;
+	int values[2] = { ANY, ANY };
+	if (_pyParseFast(args, nargs, "ffff|ii", &x, &y, &z, &r, &values[0], &values[1]))
+		_spatialKeywords("players_in_range", args, nargs, kwnames, names, 2, nargs - 4, values);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	if (!(r >= 0.0f))
+	{
+		PyErr_SetString(PyExc_ValueError, "range must not be negative");
+		return NULL;
+	}
+
+	cell ids[MAX_PLAYERS];
+	m_gridLock.Lock();
+	int count = _gridInRange(&m_playerGrid, x, y, z, r, values[0], values[1], ids);
+	m_gridLock.Unlock();
+
+	return _pyNewArray("i", ids, count * sizeof(cell));
+}
+
+// nearest_players(playerid, k)
+// returns the ids of the k players nearest to playerid in its world and interior as
+// array('i'), nearest first; empty if playerid wasn't connected at the last tick
+PyObject *sNearestPlayers(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	int playerid, k;
+	_pyParseFast(args, nargs, "ii", &playerid, &k);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	if (k < 0)
+	{
+		PyErr_SetString(PyExc_ValueError, "k must not be negative");
+		return NULL;
+	}
+
+	cell ids[MAX_PLAYERS];
+	int count = 0;
+	if (playerid >= 0 && playerid < MAX_PLAYERS)
+	{
+		m_gridLock.Lock();
+		count = _gridNearest(playerid, k, ids);
+		m_gridLock.Unlock();
+	}
+
+	return _pyNewArray("i", ids, count * sizeof(cell));
+}
+
+// vehicles_in_range(x, y, z, r, world = -1)
+// like players_in_range, for the vehicles indexed with enable_spatial_index(True, True)
+PyObject *sVehiclesInRange(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+	static const char *const names[] = { "world" };
+	float x, y, z, r;
+	int world = ANY;
+	if (_pyParseFast(args, nargs, "ffff|i", &x, &y, &z, &r, &world))
+		_spatialKeywords("vehicles_in_range", args, nargs, kwnames, names, 1, nargs - 4, &world);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	if (!(r >= 0.0f))
+	{
+		PyErr_SetString(PyExc_ValueError, "range must not be negative");
+		return NULL;
+	}
+
+	cell *ids = (cell *)PyMem_Malloc(MAX_VEHICLES * sizeof(cell));
+	if (ids == NULL)
+		return PyErr_NoMemory();
+
+	m_gridLock.Lock();
+	int count = _gridInRange(&m_vehicleGrid, x, y, z, r, world, ANY, ids);
+	m_gridLock.Unlock();
+
+	PyObject *ret = _pyNewArray("i", ids, count * sizeof(cell));
+	PyMem_Free(ids);
+	return ret;
+}
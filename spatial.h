@@ -0,0 +1,38 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __spatial_h_
+#define __spatial_h_
+
+// uniform grid over the positions of all connected players (and optionally all
+// vehicles), rebuilt once per server tick. Cells are GRID_CELL_SIZE units wide in x and
+// y and keyed by virtual world as well, so players in other worlds at the same spot
+// never share a bucket; interiors are checked per entry. Queries answer from the last
+// tick's positions.
+#define GRID_CELL_SIZE		50.0f
+#define GRID_BUCKETS		4096	// power of two
+
+extern bool m_spatialEnabled;
+
+void _spatialUpdate();
+void _spatialPlayerDisconnect(cell playerid);
+
+PyObject *sEnableSpatialIndex(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sPlayersInRange(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
+PyObject *sNearestPlayers(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sVehiclesInRange(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames);
+
+#endif
@@ -0,0 +1,129 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Allocation test for _cp1252FromAMX: decodes callback strings straight from AMX memory
+// and checks that the resulting str is the only allocation, with no new[] buffer in
+// between, and that it matches Python's own cp1252 codec.
+//
+// Standalone, it needs no server. Build and run from the repository root (Linux):
+//   g++ -w -DLINUX -I. -ISDK/amx $(python3-config --includes) tests/cp1252_alloc.cpp cp1252.cpp \
+//       SDK/amxplugin.cpp $(python3-config --embed --ldflags) -o cp1252_alloc && ./cp1252_alloc
+// It prints one line per string and exits with 1 if any of them failed.
+
+#include "pythonplugin.h"
+#include "cp1252.h"
+#include <new>
+
+logprintf_t logprintf;
+extern void *pAMXFunctions;
+
+static cell m_mem[256];
+static void *m_exports[64];
+static long m_news = 0;
+static long m_pyAllocs = 0;
+static bool m_counting = false;
+
+void *operator new[](size_t size)
+{
+	if (m_counting) m_news++;
+	void *p = malloc(size ? size : 1);
+	if (p == NULL) throw std::bad_alloc();
+	return p;
+}
+void operator delete[](void *p) noexcept { free(p); }
+
+static int AMXAPI _fakeGetAddr(AMX *amx, cell amx_addr, cell **phys_addr)
+{
+	if (amx_addr < 0 || amx_addr >= (cell)sizeof(m_mem))
+		return AMX_ERR_MEMACCESS;
+	*phys_addr = m_mem + amx_addr / sizeof(cell);
+	return AMX_ERR_NONE;
+}
+
+// counts every allocation of the mem and object domains
+static PyMemAllocatorEx m_memAlloc, m_objAlloc;
+static void *_countMalloc(void *ctx, size_t size) { if (m_counting) m_pyAllocs++; return ((PyMemAllocatorEx *)ctx)->malloc(((PyMemAllocatorEx *)ctx)->ctx, size); }
+static void *_countCalloc(void *ctx, size_t n, size_t size) { if (m_counting) m_pyAllocs++; return ((PyMemAllocatorEx *)ctx)->calloc(((PyMemAllocatorEx *)ctx)->ctx, n, size); }
+static void *_countRealloc(void *ctx, void *p, size_t size) { if (m_counting) m_pyAllocs++; return ((PyMemAllocatorEx *)ctx)->realloc(((PyMemAllocatorEx *)ctx)->ctx, p, size); }
+static void _countFree(void *ctx, void *p) { ((PyMemAllocatorEx *)ctx)->free(((PyMemAllocatorEx *)ctx)->ctx, p); }
+
+static void _hookAllocator(PyMemAllocatorDomain domain, PyMemAllocatorEx *orig)
+{
+	PyMem_GetAllocator(domain, orig);
+	PyMemAllocatorEx hook = { orig, _countMalloc, _countCalloc, _countRealloc, _countFree };
+	PyMem_SetAllocator(domain, &hook);
+}
+
+// writes bytes at cell 0, packed (four per cell, first one in the top byte) or unpacked
+static void _store(const char *bytes, bool packed)
+{
+	memset(m_mem, 0, sizeof(m_mem));
+	size_t len = strlen(bytes);
+	for (size_t i = 0; i < len; i++)
+	{
+		unsigned char c = (unsigned char)bytes[i];
+		if (packed)
+			m_mem[i / 4] |= (cell)((ucell)c << (24 - 8 * (i % 4)));
+		else
+			m_mem[i] = c;
+	}
+}
+
+static bool _check(const char *name, const char *bytes, bool packed)
+{
+	_store(bytes, packed);
+
+	m_news = m_pyAllocs = 0;
+	m_counting = true;
+	PyObject *str = _cp1252FromAMX(NULL, 0, true);
+	m_counting = false;
+	long news = m_news, allocs = m_pyAllocs;
+
+	PyObject *expected = PyUnicode_Decode(bytes, strlen(bytes), "cp1252", "replace");
+	bool ok = str != NULL && expected != NULL && PyUnicode_Compare(str, expected) == 0 && news == 0 && allocs <= 1;
+	printf("%-10s %-8s Python allocations %ld, new[] %ld, %s\n", name, packed ? "packed" : "unpacked", allocs, news, ok ? "ok" : "FAILED");
+
+	Py_XDECREF(str);
+	Py_XDECREF(expected);
+	return ok;
+}
+
+int main()
+{
+	Py_Initialize();
+	m_exports[PLUGIN_AMX_EXPORT_GetAddr] = (void *)_fakeGetAddr;
+	pAMXFunctions = m_exports;
+	_hookAllocator(PYMEM_DOMAIN_MEM, &m_memAlloc);
+	_hookAllocator(PYMEM_DOMAIN_OBJ, &m_objAlloc);
+
+	bool ok = true;
+	ok &= _check("ascii", "/help commands", false);
+	ok &= _check("ascii", "/help commands", true);
+	ok &= _check("latin-1", "Gr\xfc\xdf" "e aus M\xfcnchen", false);
+	ok &= _check("latin-1", "Gr\xfc\xdf" "e aus M\xfcnchen", true);
+	ok &= _check("cp1252", "\x93quoted\x94 \x96 5 \x80 \x85", false);
+	ok &= _check("cp1252", "\x93quoted\x94 \x96 5 \x80 \x85", true);
+	ok &= _check("undefined", "a\x81" "b\x9d", false);
+
+	// an address outside AMX memory raises instead of returning a str
+	PyObject *bad = _cp1252FromAMX(NULL, -4, true);
+	bool raised = bad == NULL && PyErr_ExceptionMatches(PyExc_ValueError);
+	PyErr_Clear();
+	printf("%-19s %s\n", "bad address", raised ? "ok" : "FAILED");
+	ok &= raised;
+
+	return ok ? 0 : 1;
+}
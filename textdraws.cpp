@@ -0,0 +1,845 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "pythonplugin.h"
+#include "nativefunctions.h"
+#include "pysamp.h"
+#include "scratch.h"
+#include "cp1252.h"
+#include "nativecall.h"
+#include "players.h"
+#include "textdraws.h"
+
+//-----------------------------------------
+// shadow store
+//
+// last string, colour and box of every textdraw set from Python, and whether it is
+// shown to each player. Setters that wouldn't change anything never reach the server.
+// Textdraw natives called by name (CallNativeFunction, samp.native) make the shadow
+// forget their textdraw; textdraws changed from Pawn have to be forgotten with
+// samp.textdraw_invalidate.
+//-----------------------------------------
+
+// fields whose value the shadow knows
+#define TD_TEXT			1
+#define TD_COLOR		2
+#define TD_USEBOX		4
+#define TD_BOXCOLOR		8
+
+#define PLAYER_BITS		((MAX_PLAYERS + 7) / 8)
+
+struct textdraw_shadow
+{
+	unsigned char known;	// TD_* bits
+	cell color, usebox, boxcolor;
+	char *text;				// UTF-8 of the last string, malloc'd
+	Py_ssize_t len;
+	// player textdraws only, the global ones have one bit per player:
+	// hidden - known to be hidden
+	// current - shown, and nothing changed since. The server sends new colours and
+	//   boxes only with the next show, so a show is only dropped for current ones
+	bool hidden, current;
+};
+
+static textdraw_shadow m_textdraws[MAX_TEXT_DRAWS];
+static unsigned char m_textdrawHidden[MAX_TEXT_DRAWS][PLAYER_BITS];
+static unsigned char m_textdrawCurrent[MAX_TEXT_DRAWS][PLAYER_BITS];
+// per player, allocated with the player's first textdraw
+static textdraw_shadow *m_playerTextdraws[MAX_PLAYERS];
+
+static unsigned long long m_textdrawsSent = 0, m_textdrawsSuppressed = 0, m_textdrawsInvalidated = 0;
+static Mutex m_textdrawsLock;
+
+static bool _validPlayer(cell playerid)
+{
+	return playerid >= 0 && playerid < MAX_PLAYERS;
+}
+
+// playerid of a player textdraw; keeps invalid ids from being taken for TEXTDRAW_GLOBAL
+static cell _textdrawPlayer(long playerid)
+{
+	return _validPlayer(playerid) ? playerid : INVALID_PLAYER_ID;
+}
+
+// shadow of a global (TEXTDRAW_GLOBAL) or player textdraw; NULL for invalid ids.
+// Call with the lock held.
+static textdraw_shadow *_shadowGet(cell playerid, cell textdraw)
+{
+	if (playerid == TEXTDRAW_GLOBAL)
+		return textdraw >= 0 && textdraw < MAX_TEXT_DRAWS ? &m_textdraws[textdraw] : NULL;
+
+	if (!_validPlayer(playerid) || textdraw < 0 || textdraw >= MAX_PLAYER_TEXT_DRAWS)
+		return NULL;
+	if (m_playerTextdraws[playerid] == NULL)
+	{
+		m_playerTextdraws[playerid] = (textdraw_shadow *)calloc(MAX_PLAYER_TEXT_DRAWS, sizeof(textdraw_shadow));
+		if (m_playerTextdraws[playerid] == NULL)
+			return NULL;
+	}
+	return &m_playerTextdraws[playerid][textdraw];
+}
+
+// forgets everything about a textdraw; one that was just created is hidden for everyone
+static void _shadowReset(cell playerid, cell textdraw, textdraw_shadow *td, bool created)
+{
+	free(td->text);
+	memset(td, 0, sizeof(textdraw_shadow));
+	if (playerid == TEXTDRAW_GLOBAL)
+	{
+		memset(m_textdrawHidden[textdraw], created ? 0xFF : 0, PLAYER_BITS);
+		memset(m_textdrawCurrent[textdraw], 0, PLAYER_BITS);
+	}
+	else
+		td->hidden = created;
+}
+
+static void _shadowFreePlayer(cell playerid)
+{
+	textdraw_shadow *tds = m_playerTextdraws[playerid];
+	if (tds == NULL)
+		return;
+	for (int i = 0; i < MAX_PLAYER_TEXT_DRAWS; i++)
+		free(tds[i].text);
+	free(tds);
+	m_playerTextdraws[playerid] = NULL;
+}
+
+// the look of a textdraw changed; players who see it need it shown again
+static void _shadowStale(cell playerid, cell textdraw, textdraw_shadow *td)
+{
+	if (playerid == TEXTDRAW_GLOBAL)
+		memset(m_textdrawCurrent[textdraw], 0, PLAYER_BITS);
+	else
+		td->current = false;
+}
+
+// counts an update; returns whether it has to be sent. Call with the lock held.
+static bool _shadowCount(bool send)
+{
+	if (send)
+		m_textdrawsSent++;
+	else
+		m_textdrawsSuppressed++;
+	return send;
+}
+
+// whether setting field to value changes anything; records the new value
+static bool _shadowSet(cell playerid, cell textdraw, int field, cell value)
+{
+	m_textdrawsLock.Lock();
+	bool send = true;
+	textdraw_shadow *td = _shadowGet(playerid, textdraw);
+	if (td != NULL)
+	{
+		cell *v = field == TD_COLOR ? &td->color : (field == TD_USEBOX ? &td->usebox : &td->boxcolor);
+		send = !(td->known & field) || *v != value;
+		if (send)
+		{
+			*v = value;
+			td->known |= field;
+			_shadowStale(playerid, textdraw, td);
+		}
+	}
+	send = _shadowCount(send);
+	m_textdrawsLock.Unlock();
+	return send;
+}
+
+// whether the text differs from the last one; the new text is recorded by _shadowSetText
+static bool _shadowTextChanged(cell playerid, cell textdraw, const char *text, Py_ssize_t len)
+{
+	m_textdrawsLock.Lock();
+	textdraw_shadow *td = _shadowGet(playerid, textdraw);
+	bool send = td == NULL || !(td->known & TD_TEXT) || td->len != len || memcmp(td->text, text, len) != 0;
+	if (!send)
+		_shadowCount(false);
+	m_textdrawsLock.Unlock();
+	return send;
+}
+
+// call with the lock held
+static void _shadowSetText(textdraw_shadow *td, const char *text, Py_ssize_t len)
+{
+	char *copy = (char *)realloc(td->text, len + 1);
+	if (copy == NULL)
+	{
+		td->known &= ~TD_TEXT;
+		return;
+	}
+	memcpy(copy, text, len + 1);
+	td->text = copy;
+	td->len = len;
+	td->known |= TD_TEXT;
+}
+
+// shows or hides a textdraw for one player; whether the server has to be told
+static bool _shadowShow(cell playerid, cell textdraw, bool global, bool show)
+{
+	m_textdrawsLock.Lock();
+	bool send = true;
+	if (global)
+	{
+		if (_validPlayer(playerid) && textdraw >= 0 && textdraw < MAX_TEXT_DRAWS)
+		{
+			unsigned char bit = 1 << (playerid % 8);
+			unsigned char &hidden = m_textdrawHidden[textdraw][playerid / 8];
+			unsigned char &current = m_textdrawCurrent[textdraw][playerid / 8];
+			send = show ? !(current & bit) : !(hidden & bit);
+			hidden = show ? hidden & ~bit : hidden | bit;
+			current = show ? current | bit : current & ~bit;
+		}
+	}
+	else
+	{
+		textdraw_shadow *td = _shadowGet(playerid, textdraw);
+		if (td != NULL)
+		{
+			send = show ? !td->current : !td->hidden;
+			td->hidden = !show;
+			td->current = show;
+		}
+	}
+	send = _shadowCount(send);
+	m_textdrawsLock.Unlock();
+	return send;
+}
+
+// TextDrawShowForAll / TextDrawHideForAll; showing only affects connected players
+static bool _shadowShowAll(cell textdraw, bool show)
+{
+	if (textdraw < 0 || textdraw >= MAX_TEXT_DRAWS)
+		return true;
+
+	cell players[MAX_PLAYERS];
+	int count = show ? _playersCopy(players) : 0;
+
+	m_textdrawsLock.Lock();
+	unsigned char *hidden = m_textdrawHidden[textdraw], *current = m_textdrawCurrent[textdraw];
+	bool send = false;
+	if (show)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			unsigned char bit = 1 << (players[i] % 8);
+			send |= !(current[players[i] / 8] & bit);
+			hidden[players[i] / 8] &= ~bit;
+			current[players[i] / 8] |= bit;
+		}
+	}
+	else
+	{
+		for (int i = 0; i < PLAYER_BITS; i++)
+			send |= hidden[i] != 0xFF;
+		memset(hidden, 0xFF, PLAYER_BITS);
+		memset(current, 0, PLAYER_BITS);
+	}
+	send = _shadowCount(send);
+	m_textdrawsLock.Unlock();
+	return send;
+}
+
+void _textdrawChanged(cell playerid, cell textdraw)
+{
+	m_textdrawsLock.Lock();
+	textdraw_shadow *td = _shadowGet(playerid, textdraw);
+	if (td != NULL)
+		_shadowStale(playerid, textdraw, td);
+	m_textdrawsLock.Unlock();
+}
+
+// forgets the values and the visibility of a textdraw, so its next updates are all
+// sent; a player textdraw that has no shadow yet is unknown already. Call with the
+// lock held.
+static void _shadowInvalidate(cell playerid, cell textdraw)
+{
+	if (playerid == TEXTDRAW_GLOBAL)
+	{
+		if (textdraw < 0 || textdraw >= MAX_TEXT_DRAWS)
+			return;
+		m_textdraws[textdraw].known = 0;
+		memset(m_textdrawHidden[textdraw], 0, PLAYER_BITS);
+		memset(m_textdrawCurrent[textdraw], 0, PLAYER_BITS);
+	}
+	else if (_validPlayer(playerid) && m_playerTextdraws[playerid] != NULL && textdraw >= 0 && textdraw < MAX_PLAYER_TEXT_DRAWS)
+	{
+		textdraw_shadow *td = &m_playerTextdraws[playerid][textdraw];
+		td->known = 0;
+		td->hidden = false;
+		td->current = false;
+	}
+}
+
+// where the textdraw natives have the ids of the textdraw they change
+enum textdraw_native_args
+{
+	TDN_TEXTDRAW,			// (Text:text, ...)
+	TDN_PLAYER_TEXTDRAW,	// (playerid, Text:text) or (playerid, PlayerText:text, ...)
+	TDN_CREATE,				// Text:TextDrawCreate(...) returns it
+	TDN_PLAYER_CREATE		// PlayerText:CreatePlayerTextDraw(playerid, ...) returns it
+};
+
+static const struct
+{
+	const char *name;
+	textdraw_native_args args;
+	bool global;
+} m_textdrawNatives[] =
+{
+	{ "TextDrawCreate", TDN_CREATE, true },
+	{ "TextDrawDestroy", TDN_TEXTDRAW, true },
+	{ "TextDrawSetString", TDN_TEXTDRAW, true },
+	{ "TextDrawColor", TDN_TEXTDRAW, true },
+	{ "TextDrawUseBox", TDN_TEXTDRAW, true },
+	{ "TextDrawBoxColor", TDN_TEXTDRAW, true },
+	{ "TextDrawShowForAll", TDN_TEXTDRAW, true },
+	{ "TextDrawHideForAll", TDN_TEXTDRAW, true },
+	{ "TextDrawShowForPlayer", TDN_PLAYER_TEXTDRAW, true },
+	{ "TextDrawHideForPlayer", TDN_PLAYER_TEXTDRAW, true },
+	// setters the shadow doesn't track, a shown textdraw needs to be shown again
+	{ "TextDrawLetterSize", TDN_TEXTDRAW, true },
+	{ "TextDrawTextSize", TDN_TEXTDRAW, true },
+	{ "TextDrawAlignment", TDN_TEXTDRAW, true },
+	{ "TextDrawBackgroundColor", TDN_TEXTDRAW, true },
+	{ "TextDrawFont", TDN_TEXTDRAW, true },
+	{ "TextDrawSetOutline", TDN_TEXTDRAW, true },
+	{ "TextDrawSetShadow", TDN_TEXTDRAW, true },
+	{ "TextDrawSetProportional", TDN_TEXTDRAW, true },
+	{ "TextDrawSetSelectable", TDN_TEXTDRAW, true },
+	{ "TextDrawSetPreviewModel", TDN_TEXTDRAW, true },
+	{ "TextDrawSetPreviewRot", TDN_TEXTDRAW, true },
+	{ "TextDrawSetPreviewVehCol", TDN_TEXTDRAW, true },
+	{ "CreatePlayerTextDraw", TDN_PLAYER_CREATE, false },
+	{ "PlayerTextDrawDestroy", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawSetString", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawColor", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawUseBox", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawBoxColor", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawShow", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawHide", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawLetterSize", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawTextSize", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawAlignment", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawBackgroundColor", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawFont", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawSetOutline", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawSetShadow", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawSetProportional", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawSetSelectable", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawSetPreviewModel", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawSetPreviewRot", TDN_PLAYER_TEXTDRAW, false },
+	{ "PlayerTextDrawSetPreviewVehCol", TDN_PLAYER_TEXTDRAW, false },
+};
+
+// a native was called by name with params and returned retval; if it was one of the
+// textdraw natives, the textdraw it changed is forgotten. Matched by
+// name, the slots of the wrappers point at resolving or profiling thunks.
+void _textdrawNativeCalled(const char *name, const cell *params, cell retval)
+{
+	if (strstr(name, "TextDraw") == NULL)
+		return;
+
+	for (size_t i = 0; i < sizeof(m_textdrawNatives) / sizeof(m_textdrawNatives[0]); i++)
+	{
+		if (strcmp(m_textdrawNatives[i].name, name) != 0)
+			continue;
+
+		cell count = params[0] / sizeof(cell), playerid, textdraw;
+		switch (m_textdrawNatives[i].args)
+		{
+		case TDN_TEXTDRAW:
+			if (count < 1) return;
+			playerid = TEXTDRAW_GLOBAL;
+			textdraw = params[1];
+			break;
+		case TDN_PLAYER_TEXTDRAW:
+			if (count < 2) return;
+			playerid = params[1];
+			textdraw = params[2];
+			break;
+		case TDN_CREATE:
+			playerid = TEXTDRAW_GLOBAL;
+			textdraw = retval;
+			break;
+		default:
+			if (count < 1) return;
+			playerid = params[1];
+			textdraw = retval;
+			break;
+		}
+		// ShowForPlayer and HideForPlayer take a playerid, but a global textdraw
+		if (m_textdrawNatives[i].global)
+			playerid = TEXTDRAW_GLOBAL;
+
+		m_textdrawsLock.Lock();
+		_shadowInvalidate(playerid, textdraw);
+		m_textdrawsInvalidated++;
+		m_textdrawsLock.Unlock();
+		return;
+	}
+}
+
+// forgets all textdraws, e.g. because the gamemode that owned them ended
+void _textdrawsReset()
+{
+	m_textdrawsLock.Lock();
+	for (int i = 0; i < MAX_TEXT_DRAWS; i++)
+		_shadowReset(TEXTDRAW_GLOBAL, i, &m_textdraws[i], false);
+	for (int i = 0; i < MAX_PLAYERS; i++)
+		_shadowFreePlayer(i);
+	m_textdrawsLock.Unlock();
+}
+
+void _textdrawsUnload(AMX *amx)
+{
+	if (amx == m_AMX)
+		_textdrawsReset();
+}
+
+// the server destroys the player's textdraws, and a player who gets the same id
+// sees no global ones
+void _textdrawsPlayerDisconnect(cell playerid)
+{
+	if (!_validPlayer(playerid))
+		return;
+
+	unsigned char bit = 1 << (playerid % 8);
+	m_textdrawsLock.Lock();
+	_shadowFreePlayer(playerid);
+	for (int i = 0; i < MAX_TEXT_DRAWS; i++)
+	{
+		m_textdrawHidden[i][playerid / 8] |= bit;
+		m_textdrawCurrent[i][playerid / 8] &= ~bit;
+	}
+	m_textdrawsLock.Unlock();
+}
+
+//-----------------------------------------
+// wrappers
+//-----------------------------------------
+
+// calls the global or the player version of a textdraw native with one more argument
+static cell _textdrawNative(amx_function_t func, cell playerid, cell textdraw, cell value)
+{
+	cell params[4];
+	int n = 0;
+	if (playerid != TEXTDRAW_GLOBAL)
+		params[++n] = playerid;
+	params[++n] = textdraw;
+	params[++n] = value;
+	params[0] = n * sizeof(cell);
+	return func(m_AMX, params);
+}
+
+// 1 if the string was sent, 0 if it was dropped, -1 on errors
+static int _textdrawSetString(cell playerid, cell textdraw, PyObject *text)
+{
+	Py_ssize_t size = _cp1252Size(text), len;
+	if (size == -1)
+		return -1;
+	const char *utf8 = PyUnicode_AsUTF8AndSize(text, &len);
+	if (utf8 == NULL)
+		return -1;
+
+	if (!_shadowTextChanged(playerid, textdraw, utf8, len))
+		return 0;
+
+	cell addr;
+	scratch_mark mark = _scratchMark();
+	cell *cells = _scratchAllot((int)size, &addr);
+	bool ok = cells != NULL && _cp1252ToCells(text, cells, size);
+	if (ok)
+		_textdrawNative(playerid == TEXTDRAW_GLOBAL ? _textDrawSetString : _playerTextDrawSetString, playerid, textdraw, addr);
+	_scratchRelease(mark);
+	if (!ok)
+		return -1;
+
+	m_textdrawsLock.Lock();
+	textdraw_shadow *td = _shadowGet(playerid, textdraw);
+	if (td != NULL)
+		_shadowSetText(td, utf8, len);
+	_shadowCount(true);
+	m_textdrawsLock.Unlock();
+	return 1;
+}
+
+static PyObject *_textdrawCreate(cell playerid, float x, float y, PyObject *text)
+{
+	Py_ssize_t size = _cp1252Size(text), len;
+	if (size == -1)
+		return NULL;
+	const char *utf8 = PyUnicode_AsUTF8AndSize(text, &len);
+	if (utf8 == NULL)
+		return NULL;
+
+	cell params[5];
+	int n = 0;
+	if (playerid != TEXTDRAW_GLOBAL)
+		params[++n] = playerid;
+	params[++n] = amx_ftoc(x);
+	params[++n] = amx_ftoc(y);
+
+	cell textdraw = INVALID_TEXT_DRAW;
+	scratch_mark mark = _scratchMark();
+	cell *cells = _scratchAllot((int)size, &params[++n]);
+	bool ok = cells != NULL && _cp1252ToCells(text, cells, size);
+	if (ok)
+	{
+		params[0] = n * sizeof(cell);
+		textdraw = (playerid == TEXTDRAW_GLOBAL ? _textDrawCreate : _createPlayerTextDraw)(m_AMX, params);
+	}
+	_scratchRelease(mark);
+	if (!ok)
+		return NULL;
+
+	m_textdrawsLock.Lock();
+	textdraw_shadow *td = _shadowGet(playerid, textdraw);
+	if (td != NULL)
+	{
+		_shadowReset(playerid, textdraw, td, true);
+		_shadowSetText(td, utf8, len);
+	}
+	m_textdrawsLock.Unlock();
+	return PyLong_FromLong(textdraw);
+}
+
+static PyObject *_textdrawDestroy(PyObject *const *args, Py_ssize_t nargs, bool player)
+{
+	long playerid = TEXTDRAW_GLOBAL, textdraw;
+	if (player)
+		_pyParseFast(args, nargs, "ll", &playerid, &textdraw);
+	else
+		_pyParseFast(args, nargs, "l", &textdraw);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	cell params[3];
+	int n = 0;
+	if (player)
+		params[++n] = playerid = _textdrawPlayer(playerid);
+	params[++n] = textdraw;
+	params[0] = n * sizeof(cell);
+	(player ? _playerTextDrawDestroy : _textDrawDestroy)(m_AMX, params);
+
+	m_textdrawsLock.Lock();
+	textdraw_shadow *td = _shadowGet(playerid, textdraw);
+	if (td != NULL)
+		_shadowReset(playerid, textdraw, td, false);
+	m_textdrawsLock.Unlock();
+	Py_RETURN_NONE;
+}
+
+// Color, UseBox and BoxColor
+static PyObject *_textdrawField(PyObject *const *args, Py_ssize_t nargs, bool player, int field, amx_function_t func)
+{
+	long playerid = TEXTDRAW_GLOBAL, textdraw;
+	PyObject *o;
+	if (player)
+		_pyParseFast(args, nargs, "llO", &playerid, &textdraw, &o);
+	else
+		_pyParseFast(args, nargs, "lO", &textdraw, &o);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	if (player)
+		playerid = _textdrawPlayer(playerid);
+
+	cell value;
+	if (field == TD_USEBOX)
+	{
+		long v = PyLong_AsLong(o);
+		if (v == -1 && PyErr_Occurred())
+			return NULL;
+		value = v;
+	}
+	else if (!p_color::convert(o, &value))
+		return NULL;
+
+	if (_shadowSet(playerid, textdraw, field, value))
+		_textdrawNative(func, playerid, textdraw, value);
+	Py_RETURN_NONE;
+}
+
+static PyObject *_textdrawShow(PyObject *const *args, Py_ssize_t nargs, bool global, bool show, amx_function_t func)
+{
+	long playerid, textdraw;
+	_pyParseFast(args, nargs, "ll", &playerid, &textdraw);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	if (_shadowShow(playerid, textdraw, global, show))
+	{
+		cell params[3] = { 2 * sizeof(cell), playerid, textdraw };
+		func(m_AMX, params);
+	}
+	Py_RETURN_NONE;
+}
+
+static PyObject *_textdrawShowAll(PyObject *const *args, Py_ssize_t nargs, bool show)
+{
+	long textdraw;
+	_pyParseFast(args, nargs, "l", &textdraw);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	if (_shadowShowAll(textdraw, show))
+	{
+		cell params[2] = { sizeof(cell), textdraw };
+		(show ? _textDrawShowForAll : _textDrawHideForAll)(m_AMX, params);
+	}
+	Py_RETURN_NONE;
+}
+
+// int TextDrawCreate(Float:x, Float:y, text[])
+PyObject *sTextDrawCreate(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	float x, y;
+	PyObject *text;
+	_pyParseFast(args, nargs, "ffO", &x, &y, &text);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	return _textdrawCreate(TEXTDRAW_GLOBAL, x, y, text);
+}
+
+// TextDrawDestroy(Text:text)
+PyObject *sTextDrawDestroy(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawDestroy(args, nargs, false);
+}
+
+// TextDrawSetString(Text:text, string[])
+PyObject *sTextDrawSetString(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	long textdraw;
+	PyObject *text;
+	_pyParseFast(args, nargs, "lO", &textdraw, &text);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	if (_textdrawSetString(TEXTDRAW_GLOBAL, textdraw, text) == -1)
+		return NULL;
+	Py_RETURN_NONE;
+}
+
+// TextDrawColor(Text:text, color)
+PyObject *sTextDrawColor(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawField(args, nargs, false, TD_COLOR, _textDrawColor);
+}
+
+// TextDrawUseBox(Text:text, use)
+PyObject *sTextDrawUseBox(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawField(args, nargs, false, TD_USEBOX, _textDrawUseBox);
+}
+
+// TextDrawBoxColor(Text:text, color)
+PyObject *sTextDrawBoxColor(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawField(args, nargs, false, TD_BOXCOLOR, _textDrawBoxColor);
+}
+
+// TextDrawShowForPlayer(playerid, Text:text)
+PyObject *sTextDrawShowForPlayer(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawShow(args, nargs, true, true, _textDrawShowForPlayer);
+}
+
+// TextDrawHideForPlayer(playerid, Text:text)
+PyObject *sTextDrawHideForPlayer(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawShow(args, nargs, true, false, _textDrawHideForPlayer);
+}
+
+// TextDrawShowForAll(Text:text)
+PyObject *sTextDrawShowForAll(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawShowAll(args, nargs, true);
+}
+
+// TextDrawHideForAll(Text:text)
+PyObject *sTextDrawHideForAll(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawShowAll(args, nargs, false);
+}
+
+// PlayerText:CreatePlayerTextDraw(playerid, Float:x, Float:y, text[])
+PyObject *sCreatePlayerTextDraw(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	long playerid;
+	float x, y;
+	PyObject *text;
+	_pyParseFast(args, nargs, "lffO", &playerid, &x, &y, &text);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	return _textdrawCreate(_textdrawPlayer(playerid), x, y, text);
+}
+
+// PlayerTextDrawDestroy(playerid, PlayerText:text)
+PyObject *sPlayerTextDrawDestroy(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawDestroy(args, nargs, true);
+}
+
+// PlayerTextDrawSetString(playerid, PlayerText:text, string[])
+PyObject *sPlayerTextDrawSetString(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	long playerid, textdraw;
+	PyObject *text;
+	_pyParseFast(args, nargs, "llO", &playerid, &textdraw, &text);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	if (_textdrawSetString(_textdrawPlayer(playerid), textdraw, text) == -1)
+		return NULL;
+	Py_RETURN_NONE;
+}
+
+// PlayerTextDrawColor(playerid, PlayerText:text, color)
+PyObject *sPlayerTextDrawColor(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawField(args, nargs, true, TD_COLOR, _playerTextDrawColor);
+}
+
+// PlayerTextDrawUseBox(playerid, PlayerText:text, use)
+PyObject *sPlayerTextDrawUseBox(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawField(args, nargs, true, TD_USEBOX, _playerTextDrawUseBox);
+}
+
+// PlayerTextDrawBoxColor(playerid, PlayerText:text, color)
+PyObject *sPlayerTextDrawBoxColor(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawField(args, nargs, true, TD_BOXCOLOR, _playerTextDrawBoxColor);
+}
+
+// PlayerTextDrawShow(playerid, PlayerText:text)
+PyObject *sPlayerTextDrawShow(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawShow(args, nargs, false, true, _playerTextDrawShow);
+}
+
+// PlayerTextDrawHide(playerid, PlayerText:text)
+PyObject *sPlayerTextDrawHide(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	return _textdrawShow(args, nargs, false, false, _playerTextDrawHide);
+}
+
+// textdraw_batch(updates)
+// updates is an iterable of (textdraw, text) for global textdraws and
+// (playerid, textdraw, text) for player textdraws; returns how many were sent
+PyObject *sTextDrawBatch(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	PyObject *updates;
+	_pyParseFast(args, nargs, "O", &updates);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	PyObject *seq = PySequence_Fast(updates, "textdraw_batch() expects an iterable of tuples");
+	if (seq == NULL)
+		return NULL;
+
+	long sent = 0;
+	Py_ssize_t count = PySequence_Fast_GET_SIZE(seq);
+	PyObject **items = PySequence_Fast_ITEMS(seq);
+	for (Py_ssize_t i = 0; i < count; i++)
+	{
+		PyObject *item = items[i];
+		Py_ssize_t len = PyTuple_Check(item) ? PyTuple_GET_SIZE(item) : 0;
+		if (len != 2 && len != 3)
+		{
+			PyErr_Format(PyExc_TypeError, "textdraw_batch() item %zd is not a (textdraw, text) or (playerid, textdraw, text) tuple", i);
+			Py_DECREF(seq);
+			return NULL;
+		}
+
+		long playerid = TEXTDRAW_GLOBAL, textdraw;
+		if (len == 3)
+		{
+			playerid = PyLong_AsLong(PyTuple_GET_ITEM(item, 0));
+			if (playerid == -1 && PyErr_Occurred())
+				break;
+			playerid = _textdrawPlayer(playerid);
+		}
+		textdraw = PyLong_AsLong(PyTuple_GET_ITEM(item, len - 2));
+		if (textdraw == -1 && PyErr_Occurred())
+			break;
+
+		int ret = _textdrawSetString(playerid, textdraw, PyTuple_GET_ITEM(item, len - 1));
+		if (ret == -1)
+			break;
+		sent += ret;
+	}
+	Py_DECREF(seq);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+	return PyLong_FromLong(sent);
+}
+
+// textdraw_invalidate(), textdraw_invalidate(textdraw), textdraw_invalidate(playerid, textdraw)
+// forgets what the shadow knows about all textdraws, a global one or a player one, for
+// textdraws that were changed from Pawn; their next updates are all sent
+PyObject *sTextDrawInvalidate(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+	long first = 0, second = 0;
+	_pyParseFast(args, nargs, "|ll", &first, &second);
+
+	if(PyErr_Occurred() != NULL)
+		return NULL;
+
+	m_textdrawsLock.Lock();
+	if (nargs == 2)
+		_shadowInvalidate(_textdrawPlayer(first), second);
+	else if (nargs == 1)
+		_shadowInvalidate(TEXTDRAW_GLOBAL, first);
+	else
+	{
+		for (int i = 0; i < MAX_TEXT_DRAWS; i++)
+			_shadowInvalidate(TEXTDRAW_GLOBAL, i);
+		for (int i = 0; i < MAX_PLAYERS; i++)
+		{
+			for (int j = 0; m_playerTextdraws[i] != NULL && j < MAX_PLAYER_TEXT_DRAWS; j++)
+				_shadowInvalidate(i, j);
+		}
+	}
+	m_textdrawsInvalidated++;
+	m_textdrawsLock.Unlock();
+	Py_RETURN_NONE;
+}
+
+// textdraw_stats()
+// returns { sent, suppressed, invalidated }: updates passed on to the server, updates
+// dropped because they wouldn't have changed anything, and textdraws forgotten by
+// textdraw_invalidate or because a textdraw native was called by name
+PyObject *sTextDrawStats(PyObject *self, PyObject *args)
+{
+	m_textdrawsLock.Lock();
+	unsigned long long sent = m_textdrawsSent, suppressed = m_textdrawsSuppressed, invalidated = m_textdrawsInvalidated;
+	m_textdrawsLock.Unlock();
+
+	return Py_BuildValue("{s:K,s:K,s:K}", "sent", sent, "suppressed", suppressed, "invalidated", invalidated);
+}
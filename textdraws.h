@@ -0,0 +1,55 @@
+//	Python plugin for SAMP
+//	Copyright (C) 2010-2012 Fabsch
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+//
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __textdraws_h_
+#define __textdraws_h_
+
+// playerid of the global textdraws in the shadow store
+#define TEXTDRAW_GLOBAL		-1
+
+void _textdrawsReset();
+void _textdrawsUnload(AMX *amx);
+void _textdrawsPlayerDisconnect(cell playerid);
+void _textdrawNativeCalled(const char *name, const cell *params, cell retval);
+
+// textdraw setters which are dropped when they wouldn't change anything
+PyObject *sTextDrawCreate(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sTextDrawDestroy(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sTextDrawSetString(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sTextDrawColor(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sTextDrawUseBox(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sTextDrawBoxColor(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sTextDrawShowForPlayer(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sTextDrawHideForPlayer(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sTextDrawShowForAll(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sTextDrawHideForAll(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+
+PyObject *sCreatePlayerTextDraw(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sPlayerTextDrawDestroy(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sPlayerTextDrawSetString(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sPlayerTextDrawColor(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sPlayerTextDrawUseBox(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sPlayerTextDrawBoxColor(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sPlayerTextDrawShow(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sPlayerTextDrawHide(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+
+// many string updates in one call, textdraws changed from Pawn, and how many updates
+// were dropped
+PyObject *sTextDrawBatch(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sTextDrawInvalidate(PyObject *self, PyObject *const *args, Py_ssize_t nargs);
+PyObject *sTextDrawStats(PyObject *self, PyObject *args);
+
+#endif